@@ -1,16 +1,15 @@
-#include <coop/thread.hpp>
 #include <coop/timer.hpp>
 
-#include "gawl/graphic.hpp"
+#include "gawl/asset-loader.hpp"
 #include "gawl/misc.hpp"
 #include "gawl/wayland/application.hpp"
-#include "macros/unwrap.hpp"
 
 class Callbacks : public gawl::WindowCallbacks {
   private:
-    coop::Runner*                runner;
-    std::array<gawl::Graphic, 3> graphics;
-    coop::TaskHandle             worker;
+    coop::Runner*                      runner;
+    std::unique_ptr<gawl::AssetLoader> loader;
+    std::array<gawl::Graphic, 3>       graphics;
+    coop::TaskHandle                   worker;
 
   public:
     auto refresh() -> void override {
@@ -28,29 +27,19 @@ class Callbacks : public gawl::WindowCallbacks {
     }
 
     auto on_created(gawl::Window* /*window*/) -> coop::Async<bool> override {
+        loader.reset(new gawl::AssetLoader(*std::bit_cast<gawl::WaylandWindow*>(window)));
         runner->push_task(worker_main(), &worker);
         co_return true;
     }
 
     auto worker_main() -> coop::Async<void> {
-        auto context = gawl::EGLSubObject();
-        auto thread  = coop::Thread([this, &context] {
-            context = std::bit_cast<gawl::WaylandWindow*>(window)->fork_context();
-        });
-
-        const auto loader = [&context](const char* const path) -> std::optional<gawl::Graphic> {
-            constexpr auto error_value = std::nullopt;
-
-            unwrap_v(pixbuf, gawl::PixelBuffer::from_file(path));
-            auto graphic = gawl::Graphic(pixbuf);
-            context.wait();
-            return graphic;
-        };
-
         for(auto& graphic : graphics) {
             co_await coop::sleep(std::chrono::seconds(1));
-            co_unwrap_v_mut(result, co_await thread.run(std::bind(loader, "examples/image.png")));
-            graphic = std::move(result);
+            auto result = co_await loader->load("examples/image.png");
+            if(!result) {
+                co_return;
+            }
+            graphic = std::move(*result);
             window->refresh();
         }
     }
@@ -0,0 +1,45 @@
+#include <cstdlib>
+
+#include "gawl/decode-worker.hpp"
+#include "gawl/graphic.hpp"
+#include "gawl/misc.hpp"
+#include "gawl/wayland/application.hpp"
+#include "macros/unwrap.hpp"
+
+class Callbacks : public gawl::WindowCallbacks {
+  private:
+    gawl::DecodeClient client = gawl::DecodeClient("/proc/self/exe");
+    gawl::Graphic      graphic;
+
+  public:
+    auto refresh() -> void override {
+        gawl::clear_screen({0, 0, 0, 1});
+        graphic.draw_fit_rect(*window, {{0, 0}, {800, 600}});
+    }
+
+    auto close() -> void override {
+        application->quit();
+    }
+
+    auto on_created(gawl::Window* /*window*/) -> coop::Async<bool> override {
+        constexpr auto error_value = false;
+        co_unwrap_v(pixbuf, co_await client.decode_async("examples/image.png"));
+        graphic = gawl::Graphic(pixbuf);
+        co_return true;
+    }
+};
+
+auto main(const int argc, const char* const argv[]) -> int {
+    // spawned by DecodeClient
+    if(argc == 2) {
+        return gawl::run_decode_worker(std::atoi(argv[1]));
+    }
+
+    auto runner = coop::Runner();
+    auto app    = gawl::WaylandApplication();
+    auto cbs    = std::shared_ptr<Callbacks>(new Callbacks());
+    runner.push_task(app.run());
+    runner.push_task(app.open_window({.manual_refresh = true}, std::move(cbs)));
+    runner.run();
+    return 0;
+}
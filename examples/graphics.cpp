@@ -25,6 +25,7 @@ class Callbacks : public gawl::WindowCallbacks {
         constexpr auto error_value = false;
         co_unwrap_v(pixbuf, gawl::PixelBuffer::from_file("examples/image.png"));
         graphic = gawl::Graphic(pixbuf);
+        graphic.generate_mipmap();
         co_return true;
     }
 };
@@ -1,16 +1,31 @@
-#include "gawl/polygon.hpp"
+#include "gawl/mesh.hpp"
 #include "gawl/misc.hpp"
+#include "gawl/path.hpp"
+#include "gawl/polygon.hpp"
+#include "gawl/polyline.hpp"
+#include "gawl/shape.hpp"
 #include "gawl/wayland/application.hpp"
 
 class Callbacks : public gawl::WindowCallbacks {
   private:
-    int count = 0;
+    int        count = 0;
+    gawl::Path icon;
+    gawl::Mesh grid = gawl::Mesh(gawl::MeshTopology::Lines);
 
   public:
     auto refresh() -> void override {
         gawl::clear_screen({0, 0, 0, 1});
         gawl::mask_alpha();
         const auto [w, h] = window->window_size;
+        if(!grid) {
+            // uploaded once, only the transform changes afterwards
+            auto lines = std::vector<gawl::Point>();
+            for(auto i = 0; i <= 10; i += 1) {
+                lines.insert(lines.end(), {{i * 0.1, 0}, {i * 0.1, 1}, {0, i * 0.1}, {1, i * 0.1}});
+            }
+            grid.upload(lines);
+        }
+        grid.draw(*window, gawl::Transform::scale(w, h), {0.2, 0.2, 0.2, 1});
         const auto min    = std::min(w, h);
         auto       color  = count % 120 < 60 ? (count % 120) / 60.0 : (60 - count % 60) / 60.0;
         gawl::draw_polygon(*window, std::vector<gawl::Point>{{10.0, 10.0}, {10.0, 10.0 + min / 10.0}, {10.0 + min / 10.0, 10.0}}, {1, 1, 1, color});
@@ -25,9 +40,29 @@ class Callbacks : public gawl::WindowCallbacks {
 
         gawl::draw_outlines(*window, gawl::triangulate_circle({w / 2.0, h / 2.0 + 80}, 30), {0, 0, 0, 0.1}, 3);
 
+        gawl::draw_arc(*window, {w / 4.0, h / 2.0}, min / 8.0, 10, {0.75, color}, {1, 0.5, 0, 1});
+        gawl::draw_polyline(*window, std::vector<gawl::Point>{{w / 4.0, h - 60.0}, {w / 2.0, h - 120.0 + color * 60}, {w * 3 / 4.0, h - 60.0}}, {0, 1, 0.5, 1}, {.width = 12, .join = gawl::LineJoin::Round, .cap = gawl::LineCap::Round});
+        gawl::draw_capsule(*window, {w * 3 / 4.0 - 40, h / 2.0}, {w * 3 / 4.0 + 40, h / 2.0}, 15, {0, 0.5, 1, 1});
+
+        const auto transform = gawl::Transform::translate(w / 4.0, h / 4.0) * gawl::Transform::rotate(count / 360.0);
+        icon.fill(*window, {1, 0.8, 0, 1}, transform);
+        icon.stroke(*window, {1, 1, 1, 1}, {.width = 2, .join = gawl::LineJoin::Round}, transform);
+
         count += 1;
     }
 
+    Callbacks() {
+        // heart with a hole, centered at the origin
+        icon.move_to({0, -10})
+            .cubic_to({20, -40}, {60, -10}, {0, 40})
+            .cubic_to({-60, -10}, {-20, -40}, {0, -10})
+            .close()
+            .move_to({-8, 0})
+            .quad_to({0, -8}, {8, 0})
+            .quad_to({0, 8}, {-8, 0})
+            .close();
+    }
+
     auto close() -> void override {
         application->quit();
     }
@@ -0,0 +1,57 @@
+#include <cmath>
+
+#include "gawl/graphic.hpp"
+#include "gawl/misc.hpp"
+#include "gawl/sprite-batch.hpp"
+#include "gawl/wayland/application.hpp"
+#include "macros/unwrap.hpp"
+
+class Callbacks : public gawl::WindowCallbacks {
+  private:
+    std::shared_ptr<gawl::Graphic> graphic;
+    gawl::SubGraphic               sub;
+    gawl::SpriteBatch              batch;
+    int                            frame = 0;
+
+  public:
+    auto refresh() -> void override {
+        gawl::clear_screen({0, 0, 0, 1});
+        for(auto y = 0; y < 60; y += 1) {
+            for(auto x = 0; x < 80; x += 1) {
+                const auto t    = (frame + x + y) * 0.05;
+                const auto tint = gawl::Color{0.5 + std::sin(t) / 2, 0.5 + std::cos(t) / 2, 1, 1};
+                const auto rect = gawl::Rectangle{{x * 10.0, y * 10.0}, {x * 10.0 + 10, y * 10.0 + 10}};
+                if((x + y) % 2 == 0) {
+                    batch.draw_rect(*window, *graphic, rect, tint);
+                } else {
+                    batch.draw_rect(*window, sub, rect, tint);
+                }
+            }
+        }
+        batch.flush();
+        frame += 1;
+    }
+
+    auto close() -> void override {
+        application->quit();
+    }
+
+    auto on_created(gawl::Window* /*window*/) -> coop::Async<bool> override {
+        constexpr auto error_value = false;
+        co_unwrap_v(pixbuf, gawl::PixelBuffer::from_file("examples/image.png"));
+        graphic = std::make_shared<gawl::Graphic>(pixbuf);
+        graphic->generate_mipmap();
+        sub = gawl::SubGraphic(graphic, {0, 0, int(pixbuf.width / 2), int(pixbuf.height / 2)});
+        co_return true;
+    }
+};
+
+auto main() -> int {
+    auto runner = coop::Runner();
+    auto app    = gawl::WaylandApplication();
+    auto cbs    = std::shared_ptr<Callbacks>(new Callbacks());
+    runner.push_task(app.run());
+    runner.push_task(app.open_window({.manual_refresh = false}, std::move(cbs)));
+    runner.run();
+    return 0;
+}
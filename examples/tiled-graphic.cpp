@@ -0,0 +1,56 @@
+#include "gawl/misc.hpp"
+#include "gawl/tiled-graphic.hpp"
+#include "gawl/wayland/application.hpp"
+#include "macros/unwrap.hpp"
+
+class Callbacks : public gawl::WindowCallbacks {
+  private:
+    coop::Runner*                       runner;
+    std::unique_ptr<gawl::TiledGraphic> graphic;
+    coop::TaskHandle                    loader;
+    double                              zoom = 1.0;
+
+  public:
+    auto refresh() -> void override {
+        gawl::clear_screen({0, 0, 0, 1});
+        const auto w = graphic->get_width(*window) * zoom;
+        const auto h = graphic->get_height(*window) * zoom;
+        graphic->draw_rect(*window, {{0, 0}, {w, h}});
+    }
+
+    auto close() -> void override {
+        application->quit();
+    }
+
+    auto on_created(gawl::Window* /*window*/) -> coop::Async<bool> override {
+        constexpr auto error_value = false;
+        co_unwrap_v_mut(pixbuf, gawl::PixelBuffer::from_file("examples/image.png"));
+        graphic.reset(new gawl::TiledGraphic(std::shared_ptr<gawl::TileSource>(new gawl::PixelBufferTileSource(std::move(pixbuf))), 64));
+        runner->push_task(graphic->run(*window), &loader);
+        co_return true;
+    }
+
+    auto on_scroll(const gawl::WheelAxis /*axis*/, const double value) -> coop::Async<bool> override {
+        zoom = std::clamp(zoom * (value > 0 ? 0.9 : 1.1), 0.05, 20.0);
+        window->refresh();
+        co_return true;
+    }
+
+    Callbacks(coop::Runner& runner)
+        : runner(&runner) {
+    }
+
+    ~Callbacks() {
+        loader.cancel();
+    }
+};
+
+auto main() -> int {
+    auto runner = coop::Runner();
+    auto app    = gawl::WaylandApplication();
+    auto cbs    = std::shared_ptr<Callbacks>(new Callbacks(runner));
+    runner.push_task(app.run());
+    runner.push_task(app.open_window({.manual_refresh = true}, std::move(cbs)));
+    runner.run();
+    return 0;
+}
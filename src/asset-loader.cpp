@@ -0,0 +1,149 @@
+#include <coop/promise.hpp>
+#include <coop/runner.hpp>
+
+#include "asset-loader.hpp"
+
+namespace gawl {
+namespace {
+auto cancel_request(impl::AssetRequest& request) -> void {
+    if(request.done || request.cancelled) {
+        return;
+    }
+    request.cancelled = true;
+    request.event.notify();
+}
+} // namespace
+
+auto AssetTicket::cancel() -> void {
+    if(request) {
+        cancel_request(*request);
+    }
+}
+
+auto AssetTicket::set_priority(const int priority) -> void {
+    if(request) {
+        request->priority = priority;
+    }
+}
+
+AssetLoader::Worker::Worker(WaylandWindow& window)
+    : thread([this, &window] {
+          context = window.fork_context();
+          context.release();
+      }) {}
+
+auto AssetLoader::pop() -> std::shared_ptr<impl::AssetRequest> {
+    std::erase_if(queue, [](const auto& r) { return r->cancelled; });
+    if(queue.empty()) {
+        return nullptr;
+    }
+    auto best = queue.begin();
+    for(auto i = queue.begin(); i != queue.end(); i = std::next(i)) {
+        if((*i)->priority > (*best)->priority) {
+            best = i;
+        }
+    }
+    auto ret = std::move(*best);
+    queue.erase(best);
+    return ret;
+}
+
+auto AssetLoader::worker_main(Worker& worker) -> coop::Async<void> {
+    while(true) {
+        const auto request = pop();
+        if(!request) {
+            worker.idle = true;
+            co_await worker.wakeup;
+            worker.idle = false;
+            continue;
+        }
+
+        worker.current = request;
+        auto upload    = co_await worker.thread.run([&worker, &path = request->path]() -> std::optional<Upload> {
+            auto pixbuf = PixelBuffer::from_file(path.data());
+            if(!pixbuf) {
+                return std::nullopt;
+            }
+            worker.context.make_current();
+            auto graphic = Graphic(*pixbuf);
+            auto fence   = worker.context.fence();
+            if(!fence) {
+                // no fence sync, block this worker instead
+                worker.context.wait();
+            }
+            // do not leave the context bound, the thread may exit before the next job
+            worker.context.release();
+            return Upload{std::move(graphic), std::move(fence)};
+        });
+        worker.current.reset();
+        if(!upload) {
+            request->done = true;
+            request->event.notify();
+            continue;
+        }
+        // let this worker decode the next image while gpu is copying
+        std::erase_if(completing, [](const auto& r) { return r->done || r->cancelled; });
+        completing.push_back(request);
+        runner->push_task(complete(request, std::move(*upload)));
+    }
+}
+
+auto AssetLoader::complete(const std::shared_ptr<impl::AssetRequest> request, Upload upload) -> coop::Async<void> {
+    const auto ok = upload.fence ? co_await upload.fence->wait() : true;
+    if(request->cancelled) {
+        co_return;
+    }
+    if(ok) {
+        request->result = std::move(upload.graphic);
+    }
+    request->done = true;
+    request->event.notify();
+}
+
+auto AssetLoader::load(std::string path, const int priority, AssetTicket* const ticket) -> coop::Async<std::optional<Graphic>> {
+    const auto request = std::shared_ptr<impl::AssetRequest>(new impl::AssetRequest{.path = std::move(path), .priority = priority});
+    if(ticket != nullptr) {
+        ticket->request = request;
+    }
+    queue.push_back(request);
+    for(auto& worker : workers) {
+        if(worker->idle) {
+            worker->idle = false;
+            worker->wakeup.notify();
+            break;
+        }
+    }
+
+    while(!request->done && !request->cancelled) {
+        co_await request->event;
+    }
+    if(request->cancelled) {
+        co_return std::nullopt;
+    }
+    co_return std::move(request->result);
+}
+
+AssetLoader::AssetLoader(WaylandWindow& window, const size_t num_workers)
+    : runner(window.runner) {
+    for(auto i = 0uz; i < num_workers; i += 1) {
+        auto& worker = *workers.emplace_back(new Worker(window));
+        runner->push_task(worker_main(worker), &worker.task);
+    }
+}
+
+AssetLoader::~AssetLoader() {
+    // pending loads return nullopt
+    for(auto& request : queue) {
+        cancel_request(*request);
+    }
+    for(auto& request : completing) {
+        cancel_request(*request);
+    }
+    for(auto& worker : workers) {
+        worker->task.cancel();
+        if(worker->current) {
+            cancel_request(*worker->current);
+        }
+    }
+}
+} // namespace gawl
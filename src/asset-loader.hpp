@@ -0,0 +1,74 @@
+#pragma once
+#include <memory>
+#include <string>
+
+#include <coop/generator.hpp>
+#include <coop/single-event.hpp>
+#include <coop/task-handle.hpp>
+#include <coop/thread.hpp>
+
+#include "graphic.hpp"
+#include "wayland/window.hpp"
+
+namespace gawl {
+namespace impl {
+struct AssetRequest {
+    std::string            path;
+    int                    priority;
+    bool                   cancelled = false;
+    bool                   done      = false;
+    std::optional<Graphic> result;
+    coop::SingleEvent      event;
+};
+} // namespace impl
+
+// handle to control a pending load
+class AssetTicket {
+  private:
+    friend class AssetLoader;
+
+    std::shared_ptr<impl::AssetRequest> request;
+
+  public:
+    // the load returns nullopt
+    auto cancel() -> void;
+    auto set_priority(int priority) -> void;
+};
+
+// decodes and uploads images on worker threads with shared gl contexts
+class AssetLoader {
+  private:
+    struct Worker {
+        EGLSubObject                        context; // current on the thread only while a job runs
+        coop::Thread                        thread;
+        coop::SingleEvent                   wakeup;
+        coop::TaskHandle                    task;
+        std::shared_ptr<impl::AssetRequest> current;
+        bool                                idle = false;
+
+        Worker(WaylandWindow& window);
+    };
+
+    struct Upload {
+        Graphic              graphic;
+        std::optional<Fence> fence; // nullopt if already finished
+    };
+
+    coop::Runner*                                    runner;
+    std::vector<std::unique_ptr<Worker>>             workers;
+    std::vector<std::shared_ptr<impl::AssetRequest>> queue;
+    std::vector<std::shared_ptr<impl::AssetRequest>> completing; // waiting for upload fences
+
+    auto pop() -> std::shared_ptr<impl::AssetRequest>;
+    auto worker_main(Worker& worker) -> coop::Async<void>;
+
+    static auto complete(std::shared_ptr<impl::AssetRequest> request, Upload upload) -> coop::Async<void>;
+
+  public:
+    // requests with higher priority are processed first
+    auto load(std::string path, int priority = 0, AssetTicket* ticket = nullptr) -> coop::Async<std::optional<Graphic>>;
+
+    AssetLoader(WaylandWindow& window, size_t num_workers = 2);
+    ~AssetLoader();
+};
+} // namespace gawl
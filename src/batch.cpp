@@ -0,0 +1,29 @@
+#include <utility>
+
+#include "batch.hpp"
+
+namespace gawl::impl {
+namespace {
+thread_local auto pending = (Batcher*)(nullptr);
+} // namespace
+
+auto set_pending_batch(Batcher* const batcher) -> void {
+    if(pending != batcher) {
+        flush_pending_batch();
+        pending = batcher;
+    }
+}
+
+auto flush_pending_batch() -> void {
+    // cleared first, flush() prepares the screen, which comes back here
+    if(const auto batcher = std::exchange(pending, nullptr)) {
+        batcher->flush();
+    }
+}
+
+auto forget_pending_batch(const Batcher* const batcher) -> void {
+    if(pending == batcher) {
+        pending = nullptr;
+    }
+}
+} // namespace gawl::impl
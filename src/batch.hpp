@@ -0,0 +1,18 @@
+#pragma once
+
+namespace gawl::impl {
+// draws deferred to be merged with the following compatible ones
+class Batcher {
+  public:
+    virtual auto flush() -> void = 0;
+
+    virtual ~Batcher() {}
+};
+
+// make the batcher pending, flushing the other one first
+auto set_pending_batch(Batcher* batcher) -> void;
+// call before anything that depends on the draw order or on the state captured by pending draws
+auto flush_pending_batch() -> void;
+// call from the batcher's destructor
+auto forget_pending_batch(const Batcher* batcher) -> void;
+} // namespace gawl::impl
@@ -1,4 +1,6 @@
 #pragma once
+#include <array>
+#include <concepts>
 #include <utility>
 
 #define GL_GLEXT_PROTOTYPES
@@ -6,16 +8,67 @@
 #include <GL/glext.h>
 
 namespace gawl::impl {
+// binding state of the context current to this thread
+// binds already in effect are skipped, and unbinds are deferred until the next bind needs the slot
+struct BindCache {
+    enum Slot : int {
+        Framebuffer,
+        ArrayBuffer,
+        ElementBuffer,
+        VArray,
+        Shader,
+        Texture,
+        Count,
+        None = -1,
+    };
+
+    std::array<GLuint, Count> bound;
+    std::array<bool, Count>   valid = {};
+
+    auto invalidate() -> void {
+        valid = {};
+    }
+
+    // call after deleting a gl object, the name may be reused
+    auto forget(const Slot slot, const GLuint v) -> void {
+        if(valid[slot] && bound[slot] == v) {
+            valid[slot] = false;
+        }
+    }
+};
+
+inline thread_local auto bind_cache = BindCache();
+
+// call after making other context current
+inline auto invalidate_bind_cache() -> void {
+    bind_cache.invalidate();
+}
+
 template <typename F>
 concept BindCaller = requires(F f) {
     f.bind(GLenum(), GLuint());
+    { F::slot(GLenum()) } -> std::same_as<BindCache::Slot>;
+    { F::defer_unbind } -> std::convertible_to<bool>;
 };
 
 template <GLenum target, BindCaller F>
 class [[nodiscard]] Binder {
   private:
+    static constexpr auto slot = F::slot(target);
+
     GLuint v = 0;
 
+    static auto bind(const GLuint v) -> void {
+        if constexpr(slot != BindCache::None) {
+            if(bind_cache.valid[slot] && bind_cache.bound[slot] == v) {
+                return;
+            }
+            bind_cache.valid[slot] = true;
+            bind_cache.bound[slot] = v;
+        }
+        F::bind(target, v);
+    }
+
   public:
     auto get() const -> GLuint {
         return v;
@@ -23,7 +76,9 @@ class [[nodiscard]] Binder {
 
     auto unbind() -> void {
         v = 0;
-        F::bind(target, v);
+        if constexpr(slot == BindCache::None || !F::defer_unbind) {
+            bind(0);
+        }
     }
 
     auto operator=(Binder&& o) -> Binder& {
@@ -35,7 +90,7 @@ class [[nodiscard]] Binder {
     Binder() = default;
 
     Binder(const GLuint v) : v(v) {
-        F::bind(target, v);
+        bind(v);
     }
 
     Binder(Binder&& o) {
@@ -49,30 +104,71 @@ class [[nodiscard]] Binder {
 
 namespace bindcaller {
 struct FramebufferBindCaller {
+    // direct framebuffer operations like clear_screen() expect the default framebuffer
+    static constexpr auto defer_unbind = false;
+
+    static constexpr auto slot(const GLenum /*target*/) -> BindCache::Slot {
+        return BindCache::Framebuffer;
+    }
+
     static auto bind(const GLenum target, const GLuint b) -> void {
         glBindFramebuffer(target, b);
     }
 };
 
 struct BufferBindCaller {
+    static constexpr auto defer_unbind = true;
+
+    // a bound pixel unpack buffer changes the meaning of texture upload pointers, never leave it bound
+    static constexpr auto slot(const GLenum target) -> BindCache::Slot {
+        switch(target) {
+        case GL_ARRAY_BUFFER:
+            return BindCache::ArrayBuffer;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return BindCache::ElementBuffer;
+        default:
+            return BindCache::None;
+        }
+    }
+
     static auto bind(const GLenum target, const GLuint b) -> void {
         glBindBuffer(target, b);
     }
 };
 
 struct VArrayBindCaller {
+    static constexpr auto defer_unbind = true;
+
+    static constexpr auto slot(const GLenum /*target*/) -> BindCache::Slot {
+        return BindCache::VArray;
+    }
+
     static auto bind(const GLenum /*target*/, const GLuint b) -> void {
         glBindVertexArray(b);
+        // element buffer binding is a part of the vertex array state
+        bind_cache.valid[BindCache::ElementBuffer] = false;
     }
 };
 
 struct ShaderBindCaller {
+    static constexpr auto defer_unbind = true;
+
+    static constexpr auto slot(const GLenum /*target*/) -> BindCache::Slot {
+        return BindCache::Shader;
+    }
+
     static auto bind(const GLenum /*target*/, const GLuint b) -> void {
         glUseProgram(b);
     }
 };
 
 struct TextureBindCaller {
+    static constexpr auto defer_unbind = true;
+
+    static constexpr auto slot(const GLenum /*target*/) -> BindCache::Slot {
+        return BindCache::Texture;
+    }
+
     static auto bind(const GLenum target, const GLuint b) -> void {
         glBindTexture(target, b);
     }
@@ -82,6 +178,7 @@ struct TextureBindCaller {
 using FramebufferBinder   = Binder<GL_FRAMEBUFFER, bindcaller::FramebufferBindCaller>;
 using VertexBufferBinder  = Binder<GL_ARRAY_BUFFER, bindcaller::BufferBindCaller>;
 using ElementBufferBinder = Binder<GL_ELEMENT_ARRAY_BUFFER, bindcaller::BufferBindCaller>;
+using PixelUnpackBinder   = Binder<GL_PIXEL_UNPACK_BUFFER, bindcaller::BufferBindCaller>;
 using VArrayBinder        = Binder<0, bindcaller::VArrayBindCaller>;
 using ShaderBinder        = Binder<0, bindcaller::ShaderBindCaller>;
 using TextureBinder       = Binder<GL_TEXTURE_2D, bindcaller::TextureBindCaller>;
@@ -1,5 +1,7 @@
 #pragma once
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdint>
 
 namespace gawl {
@@ -13,4 +15,16 @@ constexpr auto parse_color_code(uint32_t num) -> Color {
     ret[3]   = (num >> 0 & 0xFF) / 255.0;
     return ret;
 }
+
+namespace impl {
+// for normalized unsigned byte vertex attributes
+// clamps out of range components, rounds to nearest
+inline auto to_rgba8(const Color& color) -> std::array<uint8_t, 4> {
+    auto ret = std::array<uint8_t, 4>();
+    for(auto i = 0; i < 4; i += 1) {
+        ret[i] = uint8_t(std::lround(std::clamp(color[i], 0.0, 1.0) * 255));
+    }
+    return ret;
+}
+} // namespace impl
 } // namespace gawl
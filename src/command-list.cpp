@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <cstring>
+
+#include "batch.hpp"
+#include "command-list.hpp"
+#include "global.hpp"
+
+namespace gawl {
+namespace {
+auto draw_sprites(Screen& screen, impl::SpriteShader& gl, const GLuint buffer, const size_t offset, const size_t count, const GLuint texture) -> void {
+    const auto vabinder = gl.bind_vao();
+    const auto vbbinder = impl::VertexBufferBinder(buffer);
+    const auto shbinder = gl.use_shader();
+    const auto fbbinder = screen.prepare();
+    const auto txbinder = impl::TextureBinder(texture);
+    gl.set_vertices(offset);
+    gl.set_transform(screen);
+    const auto total = count / 4;
+    for(auto done = 0uz; done < total; done += impl::SpriteShader::max_quads) {
+        const auto quads = std::min(total - done, impl::SpriteShader::max_quads);
+        glDrawElementsBaseVertex(GL_TRIANGLES, GLsizei(quads * 6), GL_UNSIGNED_INT, 0, GLint(done * 4));
+    }
+}
+
+// rect and shape instances
+auto draw_instances(Screen& screen, auto& gl, const GLuint buffer, const size_t offset, const size_t count) -> void {
+    const auto vabinder = gl.bind_vao();
+    const auto vbbinder = impl::VertexBufferBinder(buffer);
+    const auto shbinder = gl.use_shader();
+    const auto fbbinder = screen.prepare();
+    gl.set_instances(offset);
+    gl.set_transform(screen);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, GLsizei(count));
+}
+} // namespace
+
+auto CommandRecorder::record(const impl::RecordKind kind, const void* const data, const size_t count, const size_t stride, const GLuint texture) -> void {
+    auto&      staging = list->staging;
+    const auto offset  = (staging.size() + stride - 1) / stride * stride;
+    staging.resize(offset + count * stride);
+    std::memcpy(staging.data() + offset, data, count * stride);
+
+    auto& commands = list->commands;
+    if(!commands.empty()) {
+        auto& last = commands.back();
+        if(last.count != 0 && last.kind == kind && last.texture == texture && last.offset + last.count * stride == offset) {
+            last.count += count;
+            return;
+        }
+    }
+    commands.push_back({kind, offset, count, texture});
+}
+
+auto CommandRecorder::record_call(std::function<void(Screen&)> call) -> void {
+    list->commands.push_back({{}, list->calls.size(), 0, 0});
+    list->calls.push_back(std::move(call));
+}
+
+auto CommandRecorder::get_scale() const -> double {
+    return target->get_scale();
+}
+
+auto CommandRecorder::get_viewport() const -> const Viewport& {
+    return target->get_viewport();
+}
+
+auto CommandRecorder::prepare() -> impl::FramebufferBinder {
+    return target->prepare();
+}
+
+auto CommandRecorder::set_viewport(const Rectangle& rect) -> void {
+    target->set_viewport(rect);
+}
+
+auto CommandRecorder::unset_viewport() -> void {
+    target->unset_viewport();
+}
+
+auto CommandRecorder::has_stencil_buffer() const -> bool {
+    return target->has_stencil_buffer();
+}
+
+auto CommandRecorder::get_recorder() -> impl::Recorder* {
+    return this;
+}
+
+auto CommandRecorder::get_visible_rect() const -> std::optional<Rectangle> {
+    // the list may be replayed anywhere
+    return std::nullopt;
+}
+
+CommandRecorder::CommandRecorder(CommandList& list, Screen& target)
+    : list(&list),
+      target(&target) {}
+
+CommandRecorder::~CommandRecorder() {
+    // pending batches of this screen still hold the tail of the recording
+    impl::flush_pending_batch();
+    list->compile();
+}
+
+auto CommandList::compile() -> void {
+    if(staging.empty()) {
+        return;
+    }
+    if(buffer == 0) {
+        glGenBuffers(1, &buffer);
+    }
+    const auto vbbinder = impl::VertexBufferBinder(buffer);
+    glBufferData(GL_ARRAY_BUFFER, staging.size(), staging.data(), GL_STATIC_DRAW);
+    staging.clear();
+    staging.shrink_to_fit();
+}
+
+auto CommandList::record(Screen& target) -> CommandRecorder {
+    clear();
+    return CommandRecorder(*this, target);
+}
+
+auto CommandList::replay(Screen& screen) const -> void {
+    impl::flush_pending_batch();
+    if(const auto recorder = screen.get_recorder()) {
+        recorder->record_call([this](Screen& screen) { replay(screen); });
+        return;
+    }
+
+    using Kind = impl::RecordKind;
+    auto& g    = *impl::global;
+    for(const auto& command : commands) {
+        if(command.count == 0) {
+            calls[command.offset](screen);
+            continue;
+        }
+        switch(command.kind) {
+        case Kind::Polygons: {
+            auto&      gl       = g.polygon_shader;
+            const auto vabinder = gl.bind_vao();
+            const auto vbbinder = impl::VertexBufferBinder(buffer);
+            const auto shbinder = gl.use_shader();
+            const auto fbbinder = screen.prepare();
+            gl.set_vertices(command.offset);
+            gl.set_transform(screen);
+            glDrawArrays(GL_TRIANGLES, 0, GLsizei(command.count));
+        } break;
+        case Kind::Sprites:
+            draw_sprites(screen, g.sprite_shader, buffer, command.offset, command.count, command.texture);
+            break;
+        case Kind::Glyphs:
+            draw_sprites(screen, g.glyph_shader, buffer, command.offset, command.count, command.texture);
+            break;
+        case Kind::Rects:
+            draw_instances(screen, g.rect_shader, buffer, command.offset, command.count);
+            break;
+        case Kind::Shapes:
+            draw_instances(screen, g.shape_shader, buffer, command.offset, command.count);
+            break;
+        case Kind::Polyline: {
+            auto&      gl       = g.polyline_shader;
+            const auto vabinder = gl.bind_vao();
+            const auto vbbinder = impl::VertexBufferBinder(buffer);
+            const auto shbinder = gl.use_shader();
+            const auto fbbinder = screen.prepare();
+            gl.set_points(command.offset);
+            gl.set_transform(screen);
+            glDrawArraysInstanced(GL_TRIANGLES, 0, impl::PolylineShader::instance_vertices, GLsizei(command.count - 3));
+        } break;
+        }
+    }
+}
+
+auto CommandList::clear() -> void {
+    commands.clear();
+    staging.clear();
+    calls.clear();
+}
+
+CommandList::~CommandList() {
+    if(buffer != 0) {
+        glDeleteBuffers(1, &buffer);
+        impl::bind_cache.forget(impl::BindCache::ArrayBuffer, buffer);
+    }
+}
+} // namespace gawl
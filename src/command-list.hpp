@@ -0,0 +1,71 @@
+#pragma once
+#include <functional>
+#include <vector>
+
+#include "recorder.hpp"
+#include "screen.hpp"
+
+namespace gawl {
+class CommandList;
+
+// screen capturing draws into a command list instead of executing them
+// scale and viewport are those of the target, set_viewport() applies to the target and is not recorded
+// the list is compiled when the recorder is destroyed
+class CommandRecorder : public Screen, private impl::Recorder {
+  private:
+    CommandList* list;
+    Screen*      target;
+
+    auto record(impl::RecordKind kind, const void* data, size_t count, size_t stride, GLuint texture) -> void override;
+    auto record_call(std::function<void(Screen&)> call) -> void override;
+
+  public:
+    auto get_scale() const -> double override;
+    auto get_viewport() const -> const Viewport& override;
+    auto prepare() -> impl::FramebufferBinder override;
+    auto set_viewport(const Rectangle& rect) -> void override;
+    auto unset_viewport() -> void override;
+    auto has_stencil_buffer() const -> bool override;
+    auto get_recorder() -> impl::Recorder* override;
+    auto get_visible_rect() const -> std::optional<Rectangle> override;
+
+    CommandRecorder(CommandList& list, Screen& target);
+    CommandRecorder(const CommandRecorder&) = delete;
+    ~CommandRecorder();
+};
+
+// retained draws with their vertex data resolved and uploaded once
+// replaying a list while recording another one references it, so sub lists can be re-recorded individually
+// graphics, meshes, paths and sub lists drawn into the list must outlive it
+// sprites keep the texture name, so a graphic must not be replaced by a new texture while the list refers to it
+// draws of CachedGraphic are recorded as calls resolving the texture at each replay, the cache must outlive the list
+// state changes like clear_screen() and mask_alpha() are not recorded
+class CommandList {
+  private:
+    friend class CommandRecorder;
+
+    struct Command {
+        impl::RecordKind kind;
+        size_t           offset; // in bytes, or the index of the call
+        size_t           count;  // 0 for calls
+        GLuint           texture;
+    };
+
+    std::vector<Command>                      commands;
+    std::vector<std::byte>                    staging;
+    std::vector<std::function<void(Screen&)>> calls;
+    GLuint                                    buffer = 0;
+
+    auto compile() -> void;
+
+  public:
+    // start recording, the previous contents are discarded
+    auto record(Screen& target) -> CommandRecorder;
+    auto replay(Screen& screen) const -> void;
+    auto clear() -> void;
+
+    CommandList()                   = default;
+    CommandList(const CommandList&) = delete;
+    ~CommandList();
+};
+} // namespace gawl
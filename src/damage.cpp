@@ -0,0 +1,27 @@
+#include <algorithm>
+
+#include "damage.hpp"
+
+namespace gawl::impl {
+auto DamageHistory::get_repaint(const Rectangle& damage, const int age) const -> std::optional<Rectangle> {
+    // the buffer of age n lacks the damage of the last n - 1 frames
+    if(age <= 0 || size_t(age - 1) > count) {
+        return std::nullopt;
+    }
+    auto region = damage;
+    for(auto i = 0uz; i + 1 < size_t(age); i += 1) {
+        region |= frames[i];
+    }
+    return region;
+}
+
+auto DamageHistory::push(const Rectangle& damage) -> void {
+    std::shift_right(frames.begin(), frames.end(), 1);
+    frames[0] = damage;
+    count     = std::min(count + 1, max_age);
+}
+
+auto DamageHistory::clear() -> void {
+    count = 0;
+}
+} // namespace gawl::impl
@@ -0,0 +1,23 @@
+#pragma once
+#include <array>
+#include <optional>
+
+#include "rect.hpp"
+
+namespace gawl::impl {
+// damage of the recent frames, to repaint back buffers that are some frames old
+class DamageHistory {
+  private:
+    static constexpr auto max_age = 4uz;
+
+    std::array<Rectangle, max_age> frames; // newest first
+    size_t                         count = 0;
+
+  public:
+    // region to repaint a buffer of the age, nullopt if it must be repainted entirely
+    // age is the EGL_EXT_buffer_age value, 0 for unknown contents
+    auto get_repaint(const Rectangle& damage, int age) const -> std::optional<Rectangle>;
+    auto push(const Rectangle& damage) -> void;
+    auto clear() -> void;
+};
+} // namespace gawl::impl
@@ -0,0 +1,11 @@
+#include <cstdlib>
+
+#include "decode-worker.hpp"
+
+// default helper of DecodeClient
+auto main(const int argc, const char* const argv[]) -> int {
+    if(argc != 2) {
+        return 1;
+    }
+    return gawl::run_decode_worker(std::atoi(argv[1]));
+}
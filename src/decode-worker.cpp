@@ -0,0 +1,199 @@
+#include <array>
+#include <cstring>
+
+#include <coop/io.hpp>
+#include <coop/promise.hpp>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "decode-worker.hpp"
+#include "macros/assert.hpp"
+#include "macros/unwrap.hpp"
+
+namespace gawl {
+namespace {
+struct Reply {
+    uint64_t width;
+    uint64_t height;
+    uint64_t size;
+    uint8_t  ok;
+};
+
+constexpr auto worker_fd    = 3;
+constexpr auto worker_seals = F_SEAL_WRITE | F_SEAL_SHRINK | F_SEAL_GROW;
+
+auto send_packet(const int socket, const void* const data, const size_t size, const int fd) -> bool {
+    auto iov = iovec{.iov_base = const_cast<void*>(data), .iov_len = size};
+    auto msg = msghdr{.msg_iov = &iov, .msg_iovlen = 1};
+
+    alignas(cmsghdr) auto control = std::array<char, CMSG_SPACE(sizeof(int))>();
+    if(fd != -1) {
+        msg.msg_control    = control.data();
+        msg.msg_controllen = control.size();
+
+        const auto cmsg  = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type  = SCM_RIGHTS;
+        cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+    }
+    return sendmsg(socket, &msg, MSG_NOSIGNAL) == ssize_t(size);
+}
+
+// returns received size, 0 if the peer is gone
+auto receive_packet(const int socket, void* const data, const size_t size, int& fd) -> ssize_t {
+    auto iov = iovec{.iov_base = data, .iov_len = size};
+    auto msg = msghdr{.msg_iov = &iov, .msg_iovlen = 1};
+
+    alignas(cmsghdr) auto control = std::array<char, CMSG_SPACE(sizeof(int))>();
+    msg.msg_control               = control.data();
+    msg.msg_controllen            = control.size();
+
+    fd             = -1;
+    const auto len = recvmsg(socket, &msg, MSG_CMSG_CLOEXEC);
+    if(len <= 0) {
+        return 0;
+    }
+    for(auto cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if(cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+        }
+    }
+    return len;
+}
+} // namespace
+
+auto run_decode_worker(const int socket) -> int {
+    auto path = std::array<char, 4096>();
+    while(true) {
+        const auto len = recv(socket, path.data(), path.size() - 1, 0);
+        if(len <= 0) {
+            return len == 0 ? 0 : 1;
+        }
+        path[len] = '\0';
+
+        auto pixbuf = PixelBuffer::from_file(path.data(), PixelStorageType::Shared);
+        if(pixbuf && !pixbuf->data.seal()) {
+            pixbuf.reset();
+        }
+        const auto reply = pixbuf ? Reply{pixbuf->width, pixbuf->height, pixbuf->data.size(), 1} : Reply{0, 0, 0, 0};
+        if(!send_packet(socket, &reply, sizeof(reply), pixbuf ? pixbuf->data.get_fd() : -1)) {
+            return 1;
+        }
+    }
+}
+
+auto DecodeClient::spawn() -> bool {
+    auto fds = std::array<int, 2>();
+    ensure(socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds.data()) == 0);
+
+    pid = fork();
+    if(pid == -1) {
+        close(fds[0]);
+        close(fds[1]);
+        bail("fork failed");
+    }
+    if(pid == 0) {
+        // the parent may have other threads holding malloc or driver locks, touch nothing but fds until exec
+        close(fds[0]);
+        // dup2 does not clear cloexec if the fds are equal
+        if(fds[1] == worker_fd) {
+            fcntl(worker_fd, F_SETFD, 0);
+        } else {
+            dup2(fds[1], worker_fd);
+        }
+        execlp(helper.data(), helper.data(), "3", nullptr);
+        _exit(127);
+    }
+    close(fds[1]);
+    socket = fds[0];
+    return true;
+}
+
+auto DecodeClient::shutdown() -> void {
+    if(socket == -1) {
+        return;
+    }
+    close(socket);
+    waitpid(pid, nullptr, 0);
+    socket = -1;
+    pid    = -1;
+}
+
+auto DecodeClient::send_request(const std::string_view path) -> bool {
+    if(socket == -1) {
+        ensure(spawn());
+    }
+    if(!send_packet(socket, path.data(), path.size(), -1)) {
+        shutdown();
+        bail("decode worker is not responding");
+    }
+    return true;
+}
+
+auto DecodeClient::receive_reply() -> std::optional<PixelBuffer> {
+    auto reply = Reply();
+    auto fd    = -1;
+    if(receive_packet(socket, &reply, sizeof(reply), fd) != sizeof(reply)) {
+        if(fd != -1) {
+            close(fd);
+        }
+        shutdown();
+        bail("decode worker died");
+    }
+    // the worker is not trusted, validate the reply before mapping
+    // the seals keep it from changing the pixels after the checks
+    auto storage = std::optional<PixelStorage>();
+    if(fd != -1) {
+        struct stat st    = {};
+        auto        len   = uint64_t();
+        const auto  seals = fcntl(fd, F_GET_SEALS);
+        if(reply.ok &&
+           fstat(fd, &st) == 0 && uint64_t(st.st_size) >= reply.size &&
+           seals != -1 && (seals & worker_seals) == worker_seals &&
+           !__builtin_mul_overflow(reply.width, reply.height, &len) && !__builtin_mul_overflow(len, 4, &len) && len <= reply.size) {
+            storage = PixelStorage::from_fd(fd, reply.size, false);
+        } else {
+            close(fd);
+        }
+    }
+    ensure(reply.ok, "failed to decode image");
+    ensure(storage, "malformed reply from decode worker");
+    return PixelBuffer{reply.width, reply.height, std::move(*storage)};
+}
+
+auto DecodeClient::decode(const std::string_view path) -> std::optional<PixelBuffer> {
+    ensure(!busy, "another request is in flight");
+    ensure(send_request(path));
+    return receive_reply();
+}
+
+auto DecodeClient::decode_async(const std::string path) -> coop::Async<std::optional<PixelBuffer>> {
+    constexpr auto error_value = std::nullopt;
+
+    co_ensure_v(!busy, "another request is in flight");
+    co_ensure_v(send_request(path));
+    busy              = true;
+    const auto result = co_await coop::wait_for_file(socket, true, false);
+    busy              = false;
+    if(result.error && !result.read) {
+        shutdown();
+        co_bail_v("decode worker died");
+    }
+    co_return receive_reply();
+}
+
+auto DecodeClient::is_running() const -> bool {
+    return socket != -1;
+}
+
+DecodeClient::DecodeClient(std::string helper)
+    : helper(std::move(helper)) {}
+
+DecodeClient::~DecodeClient() {
+    shutdown();
+}
+} // namespace gawl
@@ -0,0 +1,44 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+#include <sys/types.h>
+
+#include <coop/generator.hpp>
+
+#include "pixelbuffer.hpp"
+
+namespace gawl {
+// serves decode requests on the socket until the peer closes it
+// decoded pixels are written into memfds, sealed and sent back with SCM_RIGHTS
+auto run_decode_worker(int socket) -> int;
+
+// decodes images in a separate process, so that a malformed image cannot take down the application
+// the returned buffers map the worker's sealed memfd read-only, no copy is made between the processes
+// replies are validated, the worker is not trusted
+// requests are processed one at a time
+class DecodeClient {
+  private:
+    std::string helper;
+    int         socket = -1;
+    pid_t       pid    = -1;
+    bool        busy   = false;
+
+    auto spawn() -> bool;
+    auto shutdown() -> void;
+    auto send_request(std::string_view path) -> bool;
+    auto receive_reply() -> std::optional<PixelBuffer>;
+
+  public:
+    auto decode(std::string_view path) -> std::optional<PixelBuffer>;
+    // waits for the reply without blocking the runner
+    auto decode_async(std::string path) -> coop::Async<std::optional<PixelBuffer>>;
+    auto is_running() const -> bool;
+
+    // helper: executable which calls run_decode_worker(3), searched in PATH if it has no slash
+    // gawl-decode-worker is built from decode-worker-main.cpp
+    // a crashed worker is respawned on the next request
+    DecodeClient(std::string helper = "gawl-decode-worker");
+    ~DecodeClient();
+};
+} // namespace gawl
@@ -1,3 +1,4 @@
+#include "batch.hpp"
 #include "empty-texture.hpp"
 #include "global.hpp"
 
@@ -7,10 +8,12 @@ auto EmptyTexture::get_scale() const -> double {
 }
 
 auto EmptyTexture::set_viewport(const gawl::Rectangle& region) -> void {
+    impl::flush_pending_batch();
     viewport.set(region, {size_t(width), size_t(height)});
 }
 
 auto EmptyTexture::unset_viewport() -> void {
+    impl::flush_pending_batch();
     viewport.unset({size_t(width), size_t(height)});
 }
 
@@ -19,11 +22,17 @@ auto EmptyTexture::get_viewport() const -> const Viewport& {
 }
 
 auto EmptyTexture::prepare() -> impl::FramebufferBinder {
+    impl::flush_pending_batch();
     auto binder = impl::FramebufferBinder(frame_buffer);
     glViewport(0, 0, width, height);
+    apply_clip(std::nullopt, height);
     return binder;
 }
 
+auto EmptyTexture::has_stencil_buffer() const -> bool {
+    return stencil_buffer;
+}
+
 EmptyTexture::EmptyTexture(const int width, const int height)
     : GraphicBase(impl::global->graphic_shader) {
     this->width             = width;
@@ -40,9 +49,15 @@ EmptyTexture::EmptyTexture(const int width, const int height)
     glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, get_texture(), 0);
     const auto buffers = std::array{GLenum(GL_COLOR_ATTACHMENT0)};
     glDrawBuffers(1, buffers.data());
+
+    auto stencil_type = GLint(GL_NONE);
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &stencil_type);
+    stencil_buffer = stencil_type != GL_NONE;
 }
 
 EmptyTexture::~EmptyTexture() {
+    impl::flush_pending_batch();
     glDeleteFramebuffers(1, &frame_buffer);
+    impl::bind_cache.forget(impl::BindCache::Framebuffer, frame_buffer);
 }
 } // namespace gawl
@@ -8,6 +8,7 @@ class EmptyTexture : public impl::GraphicBase,
   private:
     GLuint   frame_buffer;
     Viewport viewport;
+    bool     stencil_buffer;
 
   public:
     auto get_scale() const -> double override;
@@ -15,6 +16,7 @@ class EmptyTexture : public impl::GraphicBase,
     auto unset_viewport() -> void override;
     auto get_viewport() const -> const Viewport& override;
     auto prepare() -> impl::FramebufferBinder override;
+    auto has_stencil_buffer() const -> bool override;
 
     EmptyTexture(int width, int height);
     ~EmptyTexture();
@@ -1,11 +1,47 @@
+#include <string_view>
+
 #include "global.hpp"
 #include "macros/assert.hpp"
 
 namespace gawl::impl {
+namespace {
+auto has_extension(const std::string_view name) -> bool {
+    auto count = GLint(0);
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for(auto i = 0; i < count; i += 1) {
+        if(name == (const char*)(glGetStringi(GL_EXTENSIONS, i))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto has_version(const GLint major, const GLint minor) -> bool {
+    auto ma = GLint(0);
+    auto mi = GLint(0);
+    glGetIntegerv(GL_MAJOR_VERSION, &ma);
+    glGetIntegerv(GL_MINOR_VERSION, &mi);
+    return ma > major || (ma == major && mi >= minor);
+}
+} // namespace
+
+auto Capabilities::init() -> void {
+    buffer_storage  = has_version(4, 4) || has_extension("GL_ARB_buffer_storage");
+    texture_storage = has_version(4, 2) || has_extension("GL_ARB_texture_storage");
+}
+
 auto Shaders::init() -> bool {
+    vertex_ring.init(4 * 1024 * 1024);
     ensure(graphic_shader.init());
     ensure(textrender_shader.init());
     ensure(polygon_shader.init());
+    ensure(polyline_shader.init());
+    ensure(mesh_shader.init());
+    ensure(rect_shader.init());
+    ensure(shape_shader.init());
+    ensure(sprite_shader.init());
+    ensure(glyph_shader.init(glyph_fragment_shader_source));
+    caps.init();
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     return true;
@@ -1,16 +1,39 @@
 #pragma once
 #include "graphic-shader.hpp"
+#include "mesh-shader.hpp"
 #include "polygon-shader.hpp"
+#include "polyline-shader.hpp"
+#include "rect-shader.hpp"
+#include "shape-shader.hpp"
+#include "sprite-shader.hpp"
 #include "textrender-shader.hpp"
+#include "vertex-ring.hpp"
 
 namespace gawl::impl {
+struct Capabilities {
+    bool buffer_storage  = false; // GL_ARB_buffer_storage, persistently mapped buffers
+    bool texture_storage = false; // GL_ARB_texture_storage, immutable textures
+
+    auto init() -> void;
+};
+
 struct Shaders {
+    VertexRing       vertex_ring;
     GraphicShader    graphic_shader;
     TextRenderShader textrender_shader;
     PolygonShader    polygon_shader;
+    PolylineShader   polyline_shader;
+    MeshShader       mesh_shader;
+    RectShader       rect_shader;
+    ShapeShader      shape_shader;
+    SpriteShader     sprite_shader;
+    SpriteShader     glyph_shader;
+    Capabilities     caps;
 
     auto init() -> bool;
 };
 
 inline auto global = (Shaders*)(nullptr);
+// number of repaints of all windows, texture caches evict when it advances
+inline auto frame_count = uint64_t(0);
 } // namespace gawl::impl
@@ -1,17 +1,50 @@
+#include "batch.hpp"
+#include "global.hpp"
 #include "graphic-base.hpp"
 #include "misc.hpp"
+#include "recorder.hpp"
 
 namespace gawl::impl {
 auto GraphicBase::do_draw(Screen& screen) const -> void {
+    // prepare() flushes batches, which bind their own vao and program
+    flush_pending_batch();
     const auto vabinder = shader->bind_vao();
     const auto ebbinder = shader->bind_ebo();
     const auto shbinder = shader->use_shader();
     const auto fbbinder = screen.prepare();
     const auto txbinder = bind_texture();
+    shader->set_transform(screen);
     shader->set_parameters(shbinder.get());
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
 }
 
+auto GraphicBase::record(Recorder& recorder, const std::array<Point, 4>& vertices, const TexCoords& uv) const -> void {
+    flush_pending_batch();
+    const auto glyph = shader == &global->textrender_shader;
+    const auto tint  = glyph ? global->textrender_shader.get_text_color() : Color{1, 1, 1, 1};
+    auto       quad  = std::array<SpriteVertex, 4>();
+    fill_sprite_quad(quad.data(), vertices, uv, invert_top_bottom, tint);
+    recorder.record(glyph ? RecordKind::Glyphs : RecordKind::Sprites, quad.data(), quad.size(), sizeof(SpriteVertex), texture);
+}
+
+auto GraphicBase::apply_filter() const -> void {
+    auto min = GLint();
+    switch(minify) {
+    case TextureFilter::Nearest:
+        min = mipmapped ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST;
+        break;
+    case TextureFilter::Linear:
+        min = mipmapped ? GL_LINEAR_MIPMAP_NEAREST : GL_LINEAR;
+        break;
+    case TextureFilter::Trilinear:
+        min = mipmapped ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR;
+        break;
+    }
+    const auto mag = magnify == TextureFilter::Nearest ? GL_NEAREST : GL_LINEAR;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, min);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, mag);
+}
+
 auto GraphicBase::bind_texture() const -> TextureBinder {
     return texture;
 }
@@ -19,6 +52,7 @@ auto GraphicBase::bind_texture() const -> TextureBinder {
 auto GraphicBase::release_texture() -> void {
     if(texture != 0) {
         glDeleteTextures(1, &texture);
+        bind_cache.forget(BindCache::Texture, texture);
     }
 }
 
@@ -26,6 +60,40 @@ auto GraphicBase::get_texture() const -> GLuint {
     return texture;
 }
 
+auto GraphicBase::get_texcoords(const std::array<int, 4>& rect) const -> TexCoords {
+    const auto w  = GLfloat(width);
+    const auto h  = GLfloat(height);
+    const auto u0 = rect[0] / w;
+    const auto u1 = (rect[0] + rect[2]) / w;
+    const auto v0 = rect[1] / h;
+    const auto v1 = (rect[1] + rect[3]) / h;
+    // inverted textures store the bottom row first
+    return invert_top_bottom ? TexCoords{u0, 1 - v1, u1, 1 - v0} : TexCoords{u0, v0, u1, v1};
+}
+
+auto GraphicBase::generate_mipmap() -> void {
+    const auto txbinder = bind_texture();
+    glGenerateMipmap(GL_TEXTURE_2D);
+    if(!mipmapped) {
+        mipmapped = true;
+        apply_filter();
+    }
+}
+
+auto GraphicBase::set_filter(const TextureFilter minify, const TextureFilter magnify) -> void {
+    this->minify        = minify;
+    this->magnify       = magnify;
+    const auto txbinder = bind_texture();
+    apply_filter();
+}
+
+auto GraphicBase::set_lod(const LodPolicy& lod) -> void {
+    const auto txbinder = bind_texture();
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_LOD_BIAS, lod.bias);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, lod.base_level);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, lod.max_level);
+}
+
 auto GraphicBase::get_width(const MetaScreen& screen) const -> int {
     return width / screen.get_scale();
 }
@@ -39,8 +107,7 @@ auto GraphicBase::draw(Screen& screen, const Point& point) const -> void {
 }
 
 auto GraphicBase::draw_rect(Screen& screen, const Rectangle& rect) const -> void {
-    shader->move_vertices(screen, Rectangle(rect) * screen.get_scale(), invert_top_bottom);
-    do_draw(screen);
+    draw_rect_uv(screen, rect, full_texcoords);
 }
 
 auto GraphicBase::draw_fit_rect(Screen& screen, const Rectangle& rect) const -> void {
@@ -48,12 +115,30 @@ auto GraphicBase::draw_fit_rect(Screen& screen, const Rectangle& rect) const ->
 }
 
 auto GraphicBase::draw_transformed(Screen& screen, const std::array<Point, 4>& vertices) const -> void {
-    auto       v = vertices;
-    const auto s = screen.get_scale();
-    for(auto& p : v) {
-        p *= s;
+    draw_transformed_uv(screen, vertices, full_texcoords);
+}
+
+auto GraphicBase::draw_rect_uv(Screen& screen, const Rectangle& rect, const TexCoords& uv) const -> void {
+    if(!screen.is_visible(bounding_box(rect.to_points()))) {
+        return;
+    }
+    if(const auto recorder = screen.get_recorder()) {
+        record(*recorder, {rect.a, {rect.b.x, rect.a.y}, rect.b, {rect.a.x, rect.b.y}}, uv);
+        return;
+    }
+    shader->move_vertices(rect, invert_top_bottom, uv);
+    do_draw(screen);
+}
+
+auto GraphicBase::draw_transformed_uv(Screen& screen, const std::array<Point, 4>& vertices, const TexCoords& uv) const -> void {
+    if(!screen.is_visible(bounding_box(vertices))) {
+        return;
+    }
+    if(const auto recorder = screen.get_recorder()) {
+        record(*recorder, vertices, uv);
+        return;
     }
-    shader->move_vertices(screen, v, invert_top_bottom);
+    shader->move_vertices(vertices, invert_top_bottom, uv);
     do_draw(screen);
 }
 
@@ -68,14 +153,16 @@ auto GraphicBase::operator=(GraphicBase&& o) -> GraphicBase& {
     width             = o.width;
     height            = o.height;
     invert_top_bottom = o.invert_top_bottom;
+    mipmapped         = o.mipmapped;
+    minify            = o.minify;
+    magnify           = o.magnify;
     return *this;
 }
 
 GraphicBase::GraphicBase(GraphicShader& shader) : shader(&shader) {
     glGenTextures(1, &texture);
     const auto txbinder = bind_texture();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    apply_filter();
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 }
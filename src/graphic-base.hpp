@@ -2,30 +2,62 @@
 #include "graphic-shader.hpp"
 #include "screen.hpp"
 
+namespace gawl {
+enum class TextureFilter {
+    Nearest,
+    Linear,    // bilinear, nearest mip level
+    Trilinear, // bilinear, blended between mip levels
+};
+
+struct LodPolicy {
+    float bias       = 0.0;
+    int   base_level = 0;
+    int   max_level  = 1000;
+};
+
+class SpriteBatch;
+} // namespace gawl
+
 namespace gawl::impl {
 class GraphicBase {
   private:
+    friend class gawl::SpriteBatch;
+
     GraphicShader* shader;
     GLuint         texture = 0;
+    TextureFilter  minify  = TextureFilter::Trilinear;
+    TextureFilter  magnify = TextureFilter::Linear;
 
     auto do_draw(Screen& screen) const -> void;
+    auto record(Recorder& recorder, const std::array<Point, 4>& vertices, const TexCoords& uv) const -> void;
+    auto apply_filter() const -> void;
 
   protected:
     int  width;
     int  height;
     bool invert_top_bottom = false;
+    bool mipmapped         = false;
 
     auto bind_texture() const -> TextureBinder;
     auto release_texture() -> void;
 
   public:
     auto get_texture() const -> GLuint;
+    // convert pixel rect {x, y, width, height} to texture coordinates
+    auto get_texcoords(const std::array<int, 4>& rect) const -> TexCoords;
+    // build mip levels from the level 0, call again after modifying pixels
+    auto generate_mipmap() -> void;
+    auto set_filter(TextureFilter minify, TextureFilter magnify = TextureFilter::Linear) -> void;
+    auto set_lod(const LodPolicy& lod) -> void;
     auto get_width(const MetaScreen& screen) const -> int;
     auto get_height(const MetaScreen& screen) const -> int;
     auto draw(Screen& screen, const Point& point) const -> void;
     auto draw_rect(Screen& screen, const Rectangle& rect) const -> void;
     auto draw_fit_rect(Screen& screen, const Rectangle& rect) const -> void;
     auto draw_transformed(Screen& screen, const std::array<Point, 4>& vertices) const -> void;
+    // draw a part of the texture
+    auto draw_rect_uv(Screen& screen, const Rectangle& rect, const TexCoords& uv) const -> void;
+    auto draw_transformed_uv(Screen& screen, const std::array<Point, 4>& vertices, const TexCoords& uv) const -> void;
 
     operator bool() const;
     auto operator=(GraphicBase&& o) -> GraphicBase&;
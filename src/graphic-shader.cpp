@@ -1,11 +1,25 @@
 #include "graphic-shader.hpp"
 #include "macros/assert.hpp"
-#include "misc.hpp"
 
 namespace gawl::impl {
-auto GraphicShader::move_vertices(const Screen& screen, const Rectangle& rect, const bool invert) -> void {
-    auto r = rect;
-    convert_screen_to_viewport(screen, r);
+namespace {
+auto set_texcoords(GLfloat (&vertices)[4][4], const TexCoords& uv) -> void {
+    vertices[0][2] = uv[0];
+    vertices[0][3] = uv[1];
+    vertices[1][2] = uv[2];
+    vertices[1][3] = uv[1];
+    vertices[2][2] = uv[2];
+    vertices[2][3] = uv[3];
+    vertices[3][2] = uv[0];
+    vertices[3][3] = uv[3];
+}
+} // namespace
+
+auto GraphicShader::set_transform(const MetaScreen& screen, const Transform& transform) -> void {
+    this->transform.set(to_ndc_matrix(screen, transform));
+}
+
+auto GraphicShader::move_vertices(const Rectangle& r, const bool invert, const TexCoords& uv) -> void {
     vertices[0][0]      = r.a.x;
     vertices[0][1]      = invert ? r.b.y : r.a.y;
     vertices[1][0]      = r.b.x;
@@ -14,13 +28,12 @@ auto GraphicShader::move_vertices(const Screen& screen, const Rectangle& rect, c
     vertices[2][1]      = invert ? r.a.y : r.b.y;
     vertices[3][0]      = r.a.x;
     vertices[3][1]      = invert ? r.a.y : r.b.y;
+    set_texcoords(vertices, uv);
     const auto vbbinder = bind_vbo();
     glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
 }
 
-auto GraphicShader::move_vertices(const Screen& screen, const std::array<Point, 4>& points, const bool invert) -> void {
-    auto v = points;
-    gawl::convert_screen_to_viewport(screen, v);
+auto GraphicShader::move_vertices(const std::array<Point, 4>& v, const bool invert, const TexCoords& uv) -> void {
     vertices[0][0]      = v[0].x;
     vertices[0][1]      = invert ? v[3].y : v[0].y;
     vertices[1][0]      = v[1].x;
@@ -29,12 +42,14 @@ auto GraphicShader::move_vertices(const Screen& screen, const std::array<Point,
     vertices[2][1]      = invert ? v[1].y : v[2].y;
     vertices[3][0]      = v[3].x;
     vertices[3][1]      = invert ? v[0].y : v[3].y;
+    set_texcoords(vertices, uv);
     const auto vbbinder = bind_vbo();
     glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
 }
 
 auto GraphicShader::init(const char* const vertex_shader_source, const char* const fragment_shader_source) -> bool {
     ensure(Shader::init(vertex_shader_source, fragment_shader_source));
+    ensure(transform.init(shader_program, "transform"));
     const auto vabinder = bind_vao();
     const auto vbbinder = bind_vbo();
     const auto ebbinder = bind_ebo();
@@ -53,15 +68,6 @@ auto GraphicShader::init(const char* const vertex_shader_source, const char* con
         2, 3, 0};
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(elements), elements, GL_STATIC_DRAW);
 
-    vertices[0][2] = 0.0;
-    vertices[0][3] = 0.0;
-    vertices[1][2] = 1.0;
-    vertices[1][3] = 0.0;
-    vertices[2][2] = 1.0;
-    vertices[2][3] = 1.0;
-    vertices[3][2] = 0.0;
-    vertices[3][3] = 1.0;
-
     return true;
 }
 } // namespace gawl::impl
@@ -4,15 +4,24 @@
 #include "shader.hpp"
 
 namespace gawl::impl {
+// normalized texture coordinates, {left, top, right, bottom}
+using TexCoords = std::array<GLfloat, 4>;
+
+constexpr auto full_texcoords = TexCoords{0, 0, 1, 1};
+
 class GraphicShader : public Shader {
   private:
-    GLfloat vertices[4][4];
+    GLfloat     vertices[4][4];
+    UniformMat3 transform;
 
   public:
     virtual auto set_parameters(GLuint /*param*/) -> void {}
 
-    auto move_vertices(const Screen& screen, const Rectangle& rect, bool invert) -> void;
-    auto move_vertices(const Screen& screen, const std::array<Point, 4>& points, bool invert) -> void;
+    // the shader must be in use
+    auto set_transform(const MetaScreen& screen, const Transform& transform = {}) -> void;
+    // in screen coordinates
+    auto move_vertices(const Rectangle& rect, bool invert, const TexCoords& uv = full_texcoords) -> void;
+    auto move_vertices(const std::array<Point, 4>& points, bool invert, const TexCoords& uv = full_texcoords) -> void;
     auto init(const char* vertex_shader_source = graphic_vertex_shader_source, const char* fragment_shader_source = graphic_fragment_shader_source) -> bool;
 
     virtual ~GraphicShader() {};
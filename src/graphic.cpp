@@ -1,8 +1,11 @@
+#include <algorithm>
+#include <bit>
+
 #include "graphic.hpp"
 #include "global.hpp"
 
 namespace gawl {
-auto Graphic::update_texture(const PixelBuffer& buffer, std::optional<std::array<int, 4>> crop) -> void {
+auto Graphic::update_texture(const std::byte* const data, const size_t width, const size_t height, std::optional<std::array<int, 4>> crop) -> void {
     const auto txbinder = this->bind_texture();
     glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
@@ -15,15 +18,79 @@ auto Graphic::update_texture(const PixelBuffer& buffer, std::optional<std::array
     } else {
         glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
         glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
-        this->width  = buffer.width;
-        this->height = buffer.height;
+        this->width  = width;
+        this->height = height;
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->width, this->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+}
+
+auto Graphic::update(const PixelBuffer& buffer, const std::span<const std::array<int, 4>> rects) -> void {
+    update(buffer.data, buffer.width, rects);
+}
+
+auto Graphic::update(const std::span<const std::byte> data, const size_t row_length, const std::span<const std::array<int, 4>> rects) -> void {
+    if(row_length == 0 || data.size() < row_length * 4) {
+        return;
     }
+    const auto txbinder = this->bind_texture();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length);
+    const auto rows = int(data.size() / (row_length * 4));
+    for(const auto& rect : rects) {
+        const auto x = std::max(rect[0], 0);
+        const auto y = std::max(rect[1], 0);
+        const auto w = std::min({rect[0] + rect[2], this->width, int(row_length)}) - x;
+        const auto h = std::min({rect[1] + rect[3], this->height, rows}) - y;
+        if(w <= 0 || h <= 0) {
+            continue;
+        }
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, x);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, y);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, data.data());
+    }
+    if(mipmapped) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+}
+
+auto Graphic::update_region(const PixelBuffer& buffer, const int x, const int y) -> void {
+    const auto txbinder = this->bind_texture();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, buffer.width);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->width, this->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, buffer.data.data());
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, buffer.width, buffer.height, GL_RGBA, GL_UNSIGNED_BYTE, buffer.data.data());
+    if(mipmapped) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+}
+
+Graphic::Graphic(const std::byte* const data, const size_t width, const size_t height)
+    : GraphicBase(impl::global->graphic_shader) {
+    update_texture(data, width, height);
 }
 
 Graphic::Graphic(const PixelBuffer& buffer, std::optional<std::array<int, 4>> crop)
     : GraphicBase(impl::global->graphic_shader) {
-    update_texture(buffer, crop);
+    update_texture(buffer.data.data(), buffer.width, buffer.height, crop);
+}
+
+Graphic::Graphic(const int width, const int height, const bool mipmap)
+    : GraphicBase(impl::global->graphic_shader) {
+    this->width  = width;
+    this->height = height;
+    {
+        const auto txbinder = this->bind_texture();
+        const auto levels   = mipmap ? int(std::bit_width(unsigned(std::max(width, height)))) : 1;
+        if(impl::global->caps.texture_storage) {
+            glTexStorage2D(GL_TEXTURE_2D, levels, GL_RGBA8, width, height);
+        } else {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        }
+    }
+    if(mipmap) {
+        generate_mipmap();
+    }
 }
 } // namespace gawl
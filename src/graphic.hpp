@@ -3,13 +3,32 @@
 #include "pixelbuffer.hpp"
 
 namespace gawl {
+class TextureStream;
+
 class Graphic : public impl::GraphicBase {
   private:
-    auto update_texture(const PixelBuffer& buffer, std::optional<std::array<int, 4>> crop = std::nullopt) -> void;
+    friend class TextureStream;
+
+    auto update_texture(const std::byte* data, size_t width, size_t height, std::optional<std::array<int, 4>> crop = std::nullopt) -> void;
+
+    // data can be an offset into the bound pixel unpack buffer
+    Graphic(const std::byte* data, size_t width, size_t height);
 
   public:
+    // rects are {x, y, width, height} in texture pixels
+    // source pixels are read from the same position of the source image
+    // mip levels are regenerated if the graphic has them
+    auto update(const PixelBuffer& buffer, std::span<const std::array<int, 4>> rects) -> void;
+    // row_length is in pixels, nothing is uploaded if data does not hold a whole row
+    auto update(std::span<const std::byte> data, size_t row_length, std::span<const std::array<int, 4>> rects) -> void;
+    // copy whole buffer to the position
+    auto update_region(const PixelBuffer& buffer, int x, int y) -> void;
+
     Graphic() = default;
+    // crop uploads a copy of the region, use SubGraphic to share the pixels instead
     Graphic(const PixelBuffer& buffer, std::optional<std::array<int, 4>> crop = std::nullopt);
+    // allocate storage only, fill it with update()
+    Graphic(int width, int height, bool mipmap = false);
 };
 
 // static checks
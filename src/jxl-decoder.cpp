@@ -46,7 +46,7 @@ class ParallelRunner {
     ParallelRunner(const uint32_t threads) : threads(threads) {}
 };
 
-auto decode_jxl(const char* const path, const uint32_t threads) -> std::optional<JxlImage> {
+auto decode_jxl(const char* const path, const uint32_t threads, const PixelStorageType storage) -> std::optional<JxlImage> {
     unwrap(file, read_file(path));
 
     const auto decoder = JxlDecoderMake(NULL);
@@ -81,9 +81,9 @@ auto decode_jxl(const char* const path, const uint32_t threads) -> std::optional
         case JXL_DEC_NEED_IMAGE_OUT_BUFFER: {
             auto buffer_size = size_t();
             ensure(JxlDecoderImageOutBufferSize(decoder.get(), &format, &buffer_size) == JXL_DEC_SUCCESS);
-            auto& buffer = frame->buffer;
-            buffer.resize(buffer_size);
-            ensure(JxlDecoderSetImageOutBuffer(decoder.get(), &format, buffer.data(), buffer.size()) == JXL_DEC_SUCCESS);
+            unwrap_mut(buffer, PixelStorage::create(buffer_size, storage));
+            frame->buffer = std::move(buffer);
+            ensure(JxlDecoderSetImageOutBuffer(decoder.get(), &format, frame->buffer.data(), frame->buffer.size()) == JXL_DEC_SUCCESS);
         } break;
         case JXL_DEC_FRAME:
             frame = &frames.emplace_back();
@@ -3,6 +3,8 @@
 #include <thread>
 #include <vector>
 
+#include "pixelstorage.hpp"
+
 namespace gawl::impl::jxl {
 struct Animation {
     uint32_t tps_numerator;
@@ -11,8 +13,8 @@ struct Animation {
 };
 
 struct Frame {
-    std::vector<std::byte> buffer;
-    uint32_t               duration;
+    PixelStorage buffer;
+    uint32_t     duration;
 };
 
 struct JxlImage {
@@ -23,5 +25,5 @@ struct JxlImage {
     bool               have_animation;
 };
 
-auto decode_jxl(const char* path, uint32_t threads = std::thread::hardware_concurrency()) -> std::optional<JxlImage>;
+auto decode_jxl(const char* path, uint32_t threads = std::thread::hardware_concurrency(), PixelStorageType storage = PixelStorageType::Heap) -> std::optional<JxlImage>;
 } // namespace gawl::impl::jxl
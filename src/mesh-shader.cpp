@@ -0,0 +1,91 @@
+#include <utility>
+
+#include "global.hpp"
+#include "macros/assert.hpp"
+#include "mesh-shader.hpp"
+#include "shader-source.hpp"
+
+namespace gawl::impl {
+auto MeshShader::setup_vertex_array() const -> void {
+    layout.enable();
+    layout.set_pointers();
+}
+
+auto MeshShader::set_transform(const Screen& screen, const Transform& transform) -> void {
+    this->transform.set(to_ndc_matrix(screen, transform));
+}
+
+auto MeshShader::set_tint(const Color& color) -> void {
+    tint.set(color);
+}
+
+auto MeshShader::init() -> bool {
+    ensure(Shader::init(mesh_vertex_shader_source, mesh_fragment_shader_source));
+    ensure(transform.init(shader_program, "transform"));
+    ensure(tint.init(shader_program, "tint"));
+    ensure(layout.init(shader_program));
+    return true;
+}
+
+auto MeshBuffer::release() -> void {
+    if(vao == 0) {
+        return;
+    }
+    glDeleteBuffers(1, &ebo);
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+    bind_cache.forget(BindCache::ElementBuffer, ebo);
+    bind_cache.forget(BindCache::ArrayBuffer, vbo);
+    bind_cache.forget(BindCache::VArray, vao);
+    vao = 0;
+    vbo = 0;
+    ebo = 0;
+}
+
+auto MeshBuffer::upload(const std::span<const MeshVertex> vertices, const std::span<const GLuint> indices) -> void {
+    if(vao == 0) {
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vbo);
+        glGenBuffers(1, &ebo);
+        const auto vabinder = VArrayBinder(vao);
+        const auto vbbinder = VertexBufferBinder(vbo);
+        const auto ebbinder = ElementBufferBinder(ebo);
+        global->mesh_shader.setup_vertex_array();
+    }
+    const auto vabinder = VArrayBinder(vao);
+    const auto vbbinder = VertexBufferBinder(vbo);
+    const auto ebbinder = ElementBufferBinder(ebo);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size_bytes(), vertices.data(), GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size_bytes(), indices.data(), GL_STATIC_DRAW);
+}
+
+auto MeshBuffer::draw_arrays(const GLenum mode, const size_t first, const size_t count) const -> void {
+    const auto vabinder = VArrayBinder(vao);
+    glDrawArrays(mode, GLint(first), GLsizei(count));
+}
+
+auto MeshBuffer::draw_elements(const GLenum mode, const size_t first, const size_t count) const -> void {
+    const auto vabinder = VArrayBinder(vao);
+    glDrawElements(mode, GLsizei(count), GL_UNSIGNED_INT, (void*)(first * sizeof(GLuint)));
+}
+
+MeshBuffer::operator bool() const {
+    return vao != 0;
+}
+
+auto MeshBuffer::operator=(MeshBuffer&& o) -> MeshBuffer& {
+    release();
+    vao = std::exchange(o.vao, 0);
+    vbo = std::exchange(o.vbo, 0);
+    ebo = std::exchange(o.ebo, 0);
+    return *this;
+}
+
+MeshBuffer::MeshBuffer(MeshBuffer&& o) {
+    *this = std::move(o);
+}
+
+MeshBuffer::~MeshBuffer() {
+    release();
+}
+} // namespace gawl::impl
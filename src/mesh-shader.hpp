@@ -0,0 +1,57 @@
+#pragma once
+#include <span>
+
+#include "screen.hpp"
+#include "shader.hpp"
+#include "transform.hpp"
+#include "vertex-layout.hpp"
+
+namespace gawl::impl {
+struct MeshVertex {
+    GLfloat x;
+    GLfloat y;
+    GLubyte color[4];
+};
+
+// draws retained vertex buffers under a transform
+class MeshShader : public Shader {
+  private:
+    using Layout = VertexLayout<Attribute<"position", &MeshVertex::x, &MeshVertex::y>,
+                                Attribute<"vertex_color", &MeshVertex::color>>;
+
+    Layout      layout;
+    UniformMat3 transform;
+    UniformVec4 tint;
+
+  public:
+    // set attribute pointers of the bound vertex array to the bound array buffer
+    auto setup_vertex_array() const -> void;
+    // the shader must be in use
+    auto set_transform(const Screen& screen, const Transform& transform) -> void;
+    auto set_tint(const Color& color) -> void;
+    auto init() -> bool;
+};
+
+// gpu resident vertices and indices in the MeshShader layout
+class MeshBuffer {
+  private:
+    GLuint vao = 0;
+    GLuint vbo = 0;
+    GLuint ebo = 0;
+
+    auto release() -> void;
+
+  public:
+    auto upload(std::span<const MeshVertex> vertices, std::span<const GLuint> indices = {}) -> void;
+    // the mesh shader must be in use
+    auto draw_arrays(GLenum mode, size_t first, size_t count) const -> void;
+    auto draw_elements(GLenum mode, size_t first, size_t count) const -> void;
+
+    operator bool() const;
+    auto operator=(MeshBuffer&& o) -> MeshBuffer&;
+
+    MeshBuffer() = default;
+    MeshBuffer(MeshBuffer&& o);
+    ~MeshBuffer();
+};
+} // namespace gawl::impl
@@ -0,0 +1,79 @@
+#include <vector>
+
+#include "batch.hpp"
+#include "global.hpp"
+#include "mesh.hpp"
+#include "recorder.hpp"
+
+namespace gawl {
+namespace {
+auto to_gl_mode(const MeshTopology topology) -> GLenum {
+    switch(topology) {
+    case MeshTopology::Triangles:
+        return GL_TRIANGLES;
+    case MeshTopology::TriangleStrip:
+        return GL_TRIANGLE_STRIP;
+    case MeshTopology::TriangleFan:
+        return GL_TRIANGLE_FAN;
+    case MeshTopology::Lines:
+        return GL_LINES;
+    case MeshTopology::LineStrip:
+        return GL_LINE_STRIP;
+    case MeshTopology::LineLoop:
+        return GL_LINE_LOOP;
+    }
+    return GL_TRIANGLES;
+}
+} // namespace
+
+auto Mesh::upload(const std::span<const Vertex> vertices, const std::span<const uint32_t> indices) -> void {
+    auto data   = std::vector<impl::MeshVertex>(vertices.size());
+    auto points = std::vector<Point>(vertices.size());
+    for(auto i = 0uz; i < vertices.size(); i += 1) {
+        const auto& v    = vertices[i];
+        const auto  rgba = impl::to_rgba8(v.color);
+        data[i]          = {GLfloat(v.point.x), GLfloat(v.point.y), {rgba[0], rgba[1], rgba[2], rgba[3]}};
+        points[i]        = v.point;
+    }
+    buffer.upload(data, indices);
+    bounds  = bounding_box(points);
+    count   = indices.empty() ? vertices.size() : indices.size();
+    indexed = !indices.empty();
+}
+
+auto Mesh::upload(const std::span<const Point> vertices, const std::span<const uint32_t> indices) -> void {
+    auto data = std::vector<impl::MeshVertex>(vertices.size(), {0, 0, {255, 255, 255, 255}});
+    impl::pack_points(vertices, data.data(), sizeof(impl::MeshVertex));
+    buffer.upload(data, indices);
+    bounds  = bounding_box(vertices);
+    count   = indices.empty() ? vertices.size() : indices.size();
+    indexed = !indices.empty();
+}
+
+auto Mesh::draw(Screen& screen, const Transform& transform, const Color& tint) const -> void {
+    if(count == 0 || !screen.is_visible(transform.apply(bounds))) {
+        return;
+    }
+    impl::flush_pending_batch();
+    if(const auto recorder = screen.get_recorder()) {
+        recorder->record_call([this, transform, tint](Screen& screen) { draw(screen, transform, tint); });
+        return;
+    }
+    auto&      gl       = impl::global->mesh_shader;
+    const auto shbinder = gl.use_shader();
+    const auto fbbinder = screen.prepare();
+    gl.set_transform(screen, transform);
+    gl.set_tint(tint);
+    if(indexed) {
+        buffer.draw_elements(to_gl_mode(topology), 0, count);
+    } else {
+        buffer.draw_arrays(to_gl_mode(topology), 0, count);
+    }
+}
+
+Mesh::operator bool() const {
+    return bool(buffer);
+}
+
+Mesh::Mesh(const MeshTopology topology) : topology(topology) {}
+} // namespace gawl
@@ -0,0 +1,45 @@
+#pragma once
+#include <span>
+
+#include "color.hpp"
+#include "mesh-shader.hpp"
+#include "screen.hpp"
+#include "transform.hpp"
+
+namespace gawl {
+enum class MeshTopology {
+    Triangles,
+    TriangleStrip,
+    TriangleFan,
+    Lines,
+    LineStrip,
+    LineLoop,
+};
+
+// vertices uploaded once and kept on the gpu
+// the transform and the tint are applied per draw in the vertex shader
+class Mesh {
+  private:
+    impl::MeshBuffer buffer;
+    MeshTopology     topology;
+    Rectangle        bounds;
+    size_t           count   = 0;
+    bool             indexed = false;
+
+  public:
+    struct Vertex {
+        Point point;
+        Color color = {1, 1, 1, 1};
+    };
+
+    // replaces the contents, vertices are drawn in order if indices are empty
+    auto upload(std::span<const Vertex> vertices, std::span<const uint32_t> indices = {}) -> void;
+    // white vertices, colored by the tint
+    auto upload(std::span<const Point> vertices, std::span<const uint32_t> indices = {}) -> void;
+    auto draw(Screen& screen, const Transform& transform = {}, const Color& tint = {1, 1, 1, 1}) const -> void;
+
+    operator bool() const;
+
+    Mesh(MeshTopology topology = MeshTopology::Triangles);
+};
+} // namespace gawl
@@ -1,6 +1,75 @@
+#include <algorithm>
+#include <vector>
+
+#include "batch.hpp"
+#include "global.hpp"
 #include "misc.hpp"
+#include "recorder.hpp"
 
 namespace gawl {
+namespace {
+// rects of a screen drawn with one instanced draw
+class RectBatch : public impl::Batcher {
+  private:
+    Screen*                         screen = nullptr;
+    std::vector<impl::RectInstance> instances;
+
+  public:
+    auto append(Screen& screen, const Rectangle& rect, const Color& fill, const Color& border, const double radius, const double border_width) -> void {
+        const auto r = bounding_box(rect.to_points());
+        if(!screen.is_visible(r)) {
+            return;
+        }
+        if(this->screen != &screen) {
+            flush();
+            this->screen = &screen;
+        }
+        impl::set_pending_batch(this);
+
+        const auto f = impl::to_rgba8(fill);
+        const auto b = impl::to_rgba8(border);
+        instances.push_back({
+            .rect         = {GLfloat(r.a.x), GLfloat(r.a.y), GLfloat(r.b.x), GLfloat(r.b.y)},
+            .fill         = {f[0], f[1], f[2], f[3]},
+            .border       = {b[0], b[1], b[2], b[3]},
+            .radius       = GLfloat(radius),
+            .border_width = GLfloat(border_width),
+        });
+    }
+
+    auto flush() -> void override {
+        impl::forget_pending_batch(this);
+        if(instances.empty()) {
+            return;
+        }
+        if(const auto recorder = screen->get_recorder()) {
+            recorder->record(impl::RecordKind::Rects, instances.data(), instances.size(), sizeof(impl::RectInstance));
+            instances.clear();
+            return;
+        }
+        auto&      gl       = impl::global->rect_shader;
+        const auto offset   = impl::global->vertex_ring.write(instances.data(), instances.size() * sizeof(impl::RectInstance), sizeof(impl::RectInstance));
+        const auto vabinder = gl.bind_vao();
+        const auto vbbinder = impl::global->vertex_ring.bind();
+        const auto shbinder = gl.use_shader();
+        const auto fbbinder = screen->prepare();
+        gl.set_instances(offset);
+        gl.set_transform(*screen);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, GLsizei(instances.size()));
+        instances.clear();
+    }
+
+    ~RectBatch() {
+        impl::forget_pending_batch(this);
+    }
+};
+
+auto get_rect_batch() -> RectBatch& {
+    static thread_local auto batch = RectBatch();
+    return batch;
+}
+} // namespace
+
 auto convert_screen_to_viewport(const Screen& screen, const std::span<Point> vertices) -> void {
     const auto& s = screen.get_viewport();
     for(auto& v : vertices) {
@@ -37,24 +106,36 @@ auto calc_fit_rect(const Rectangle& rect, const double width, const double heigh
     return {{xo, yo}, {xo + dw, yo + dh}};
 }
 
+auto flush_batches() -> void {
+    impl::flush_pending_batch();
+}
+
 auto clear_screen(const Color& color) -> void {
+    impl::flush_pending_batch();
     glClearColor(color[0], color[1], color[2], color[3]);
-    glClear(GL_COLOR_BUFFER_BIT);
+    glClearStencil(0);
+    glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 }
 
 auto draw_rect(Screen& screen, const Rectangle& rect, const Color& color) -> void {
-    auto r = rect * screen.get_scale();
-    gawl::convert_screen_to_viewport(screen, r);
-    const auto fbbinder = screen.prepare();
-    glColor4f(color[0], color[1], color[2], color[3]);
-    glRectf(r.a.x, r.a.y, r.b.x, r.b.y);
+    get_rect_batch().append(screen, rect, color, color, 0, 0);
+}
+
+auto draw_rounded_rect(Screen& screen, const Rectangle& rect, const Color& color, const double radius) -> void {
+    get_rect_batch().append(screen, rect, color, color, radius, 0);
+}
+
+auto draw_bordered_rect(Screen& screen, const Rectangle& rect, const Color& fill, const Color& border, const double border_width, const double radius) -> void {
+    get_rect_batch().append(screen, rect, fill, border, radius, border_width);
 }
 
 auto mask_alpha() -> void {
+    impl::flush_pending_batch();
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);
 }
 
 auto unmask_alpha() -> void {
+    impl::flush_pending_batch();
     glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
 }
 } // namespace gawl
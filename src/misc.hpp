@@ -10,8 +10,15 @@ namespace gawl {
 auto convert_screen_to_viewport(const Screen& screen, std::span<Point> vertices) -> void;
 auto convert_screen_to_viewport(const Screen& screen, Rectangle& rect) -> void;
 auto calc_fit_rect(const Rectangle& rect, double width, double height, Align horizontal = Align::Center, Align vertical = Align::Center) -> Rectangle;
+// issue draws deferred for batching, call before using gl directly
+auto flush_batches() -> void;
+// limited by the scissor of the latest Screen::prepare(), i.e. the repaint region and the clip at that time
 auto clear_screen(const Color& color = {0, 0, 0, 0}) -> void;
+// rects are batched and drawn with instancing, edges are antialiased
 auto draw_rect(Screen& screen, const Rectangle& rect, const Color& color) -> void;
+auto draw_rounded_rect(Screen& screen, const Rectangle& rect, const Color& color, double radius) -> void;
+// the border is drawn inside of the rect
+auto draw_bordered_rect(Screen& screen, const Rectangle& rect, const Color& fill, const Color& border, double border_width, double radius = 0) -> void;
 auto mask_alpha() -> void;
 auto unmask_alpha() -> void;
 } // namespace gawl
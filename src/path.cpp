@@ -0,0 +1,514 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "batch.hpp"
+#include "global.hpp"
+#include "path.hpp"
+#include "recorder.hpp"
+
+namespace gawl {
+namespace {
+using Polygon = std::vector<Point>;
+
+auto cross(const Point& a, const Point& b, const Point& c) -> double {
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+auto signed_area(const Polygon& polygon) -> double {
+    auto sum = 0.0;
+    for(auto i = 0uz, j = polygon.size() - 1; i < polygon.size(); j = i, i += 1) {
+        sum += polygon[j].x * polygon[i].y - polygon[i].x * polygon[j].y;
+    }
+    return sum / 2;
+}
+
+auto winding_number(const Polygon& polygon, const Point& p) -> int {
+    auto wn = 0;
+    for(auto i = 0uz, j = polygon.size() - 1; i < polygon.size(); j = i, i += 1) {
+        const auto& a = polygon[j];
+        const auto& b = polygon[i];
+        if(a.y <= p.y) {
+            if(b.y > p.y && cross(a, b, p) > 0) {
+                wn += 1;
+            }
+        } else {
+            if(b.y <= p.y && cross(a, b, p) < 0) {
+                wn -= 1;
+            }
+        }
+    }
+    return wn;
+}
+
+auto contains(const Polygon& polygon, const Point& p) -> bool {
+    auto inside = false;
+    for(auto i = 0uz, j = polygon.size() - 1; i < polygon.size(); j = i, i += 1) {
+        const auto& a = polygon[j];
+        const auto& b = polygon[i];
+        if((a.y > p.y) != (b.y > p.y) && p.x < (b.x - a.x) * (p.y - a.y) / (b.y - a.y) + a.x) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+auto in_triangle(const Point& a, const Point& b, const Point& c, const Point& p) -> bool {
+    return cross(a, b, p) >= 0 && cross(b, c, p) >= 0 && cross(c, a, p) >= 0;
+}
+
+auto equals(const Point& a, const Point& b) -> bool {
+    return a.x == b.x && a.y == b.y;
+}
+
+auto append_flattened(std::vector<Point>& points, const size_t segments, const auto& evaluate) -> void {
+    for(auto i = 1uz; i <= segments; i += 1) {
+        points.push_back(evaluate(1.0 * i / segments));
+    }
+}
+
+auto count_segments(const double deviation, const double tolerance) -> size_t {
+    return std::clamp<size_t>(std::ceil(std::sqrt(deviation / tolerance)), 1, 1024);
+}
+
+// splice the hole into the outer polygon through a bridge from its rightmost vertex
+auto bridge_hole(Polygon& outer, const Polygon& hole) -> void {
+    const auto m  = size_t(std::ranges::max_element(hole, {}, &Point::x) - hole.begin());
+    const auto& p = hole[m];
+
+    // nearest edge crossed by the ray to +x
+    auto hit_x = std::numeric_limits<double>::infinity();
+    auto found = outer.size();
+    for(auto i = 0uz, j = outer.size() - 1; i < outer.size(); j = i, i += 1) {
+        const auto& a = outer[j];
+        const auto& b = outer[i];
+        if((a.y > p.y) == (b.y > p.y) || a.y == b.y) {
+            continue;
+        }
+        const auto x = a.x + (p.y - a.y) * (b.x - a.x) / (b.y - a.y);
+        if(x >= p.x && x < hit_x) {
+            hit_x = x;
+            found = a.x > b.x ? j : i;
+        }
+    }
+    if(found == outer.size()) {
+        // degenerate input, connect to the nearest vertex
+        auto best = std::numeric_limits<double>::infinity();
+        for(auto i = 0uz; i < outer.size(); i += 1) {
+            const auto d = std::hypot(outer[i].x - p.x, outer[i].y - p.y);
+            if(d < best) {
+                best  = d;
+                found = i;
+            }
+        }
+    } else {
+        // the endpoint may be hidden by other vertices, take the one closest to the ray among them
+        const auto hit   = Point{hit_x, p.y};
+        const auto& c    = outer[found];
+        auto        best = std::abs(c.y - p.y) / std::max(c.x - p.x, 1e-12);
+        for(auto i = 0uz; i < outer.size(); i += 1) {
+            const auto& v = outer[i];
+            if(i == found || v.x < p.x) {
+                continue;
+            }
+            if(!in_triangle(p, hit, c, v) && !in_triangle(p, c, hit, v)) {
+                continue;
+            }
+            const auto slope = std::abs(v.y - p.y) / std::max(v.x - p.x, 1e-12);
+            if(slope < best) {
+                best  = slope;
+                found = i;
+            }
+        }
+    }
+
+    // outer[..found], hole[m..], hole[..m], hole[m], outer[found..]
+    auto spliced = Polygon();
+    spliced.reserve(outer.size() + hole.size() + 2);
+    spliced.insert(spliced.end(), outer.begin(), outer.begin() + found + 1);
+    spliced.insert(spliced.end(), hole.begin() + m, hole.end());
+    spliced.insert(spliced.end(), hole.begin(), hole.begin() + m + 1);
+    spliced.insert(spliced.end(), outer.begin() + found, outer.end());
+    outer = std::move(spliced);
+}
+
+// polygon must be counter clockwise in the sense of signed_area() > 0
+auto ear_clip(const Polygon& polygon, const GLuint base, std::vector<GLuint>& indices) -> void {
+    const auto n    = polygon.size();
+    auto       prev = std::vector<size_t>(n);
+    auto       next = std::vector<size_t>(n);
+    for(auto i = 0uz; i < n; i += 1) {
+        prev[i] = (i + n - 1) % n;
+        next[i] = (i + 1) % n;
+    }
+
+    const auto is_ear = [&](const size_t i) -> bool {
+        const auto& a = polygon[prev[i]];
+        const auto& b = polygon[i];
+        const auto& c = polygon[next[i]];
+        if(cross(a, b, c) <= 0) {
+            return false;
+        }
+        for(auto j = next[next[i]]; j != prev[i]; j = next[j]) {
+            const auto& p = polygon[j];
+            if(!equals(p, a) && !equals(p, b) && !equals(p, c) && in_triangle(a, b, c, p)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    const auto unlink = [&](const size_t i) {
+        next[prev[i]] = next[i];
+        prev[next[i]] = prev[i];
+    };
+
+    auto remaining = n;
+    auto stall     = 0uz;
+    for(auto i = 0uz; remaining > 3;) {
+        const auto degenerate = cross(polygon[prev[i]], polygon[i], polygon[next[i]]) == 0;
+        // no ear means self intersecting input, clip anyway to terminate
+        const auto clip = degenerate || is_ear(i) || stall > remaining;
+        if(!clip) {
+            i      = next[i];
+            stall += 1;
+            continue;
+        }
+        if(!degenerate) {
+            indices.insert(indices.end(), {GLuint(base + prev[i]), GLuint(base + i), GLuint(base + next[i])});
+        }
+        unlink(i);
+        remaining -= 1;
+        stall      = 0;
+        i          = next[i];
+        if(remaining == 3) {
+            indices.insert(indices.end(), {GLuint(base + prev[i]), GLuint(base + i), GLuint(base + next[i])});
+        }
+    }
+    if(n == 3) {
+        indices.insert(indices.end(), {base, base + 1, base + 2});
+    }
+}
+
+// contours with duplicated points removed, at least 3 points each
+auto to_polygons(const auto& contours) -> std::vector<Polygon> {
+    auto ret = std::vector<Polygon>();
+    for(const auto& contour : contours) {
+        auto polygon = Polygon();
+        for(const auto& p : contour.points) {
+            if(polygon.empty() || !equals(polygon.back(), p)) {
+                polygon.push_back(p);
+            }
+        }
+        while(polygon.size() > 1 && equals(polygon.front(), polygon.back())) {
+            polygon.pop_back();
+        }
+        if(polygon.size() >= 3) {
+            ret.push_back(std::move(polygon));
+        }
+    }
+    return ret;
+}
+
+auto to_vertex(const Point& p) -> impl::MeshVertex {
+    return {GLfloat(p.x), GLfloat(p.y), {255, 255, 255, 255}};
+}
+} // namespace
+
+auto Path::current() -> Contour& {
+    if(contours.empty() || contours.back().closed) {
+        contours.push_back({.points = {cursor}});
+    }
+    return contours.back();
+}
+
+auto Path::invalidate() -> void {
+    fill_dirty    = true;
+    stencil_dirty = true;
+    bounds.reset();
+}
+
+auto Path::get_bounds() -> const Rectangle& {
+    if(!bounds) {
+        auto r = std::optional<Rectangle>();
+        for(const auto& contour : contours) {
+            const auto b = bounding_box(contour.points);
+            r            = r ? (*r |= b) : b;
+        }
+        bounds = r.value_or(Rectangle{});
+    }
+    return *bounds;
+}
+
+auto Path::build_fill() -> void {
+    auto polygons = to_polygons(contours);
+
+    // decide which contours bound the filled region from the fill of their both sides
+    struct Ring {
+        Polygon polygon;
+        double  area;
+    };
+    auto outers = std::vector<Ring>();
+    auto holes  = std::vector<Ring>();
+    for(auto i = 0uz; i < polygons.size(); i += 1) {
+        const auto& p    = polygons[i][0];
+        const auto  area = signed_area(polygons[i]);
+        if(area == 0) {
+            continue;
+        }
+        auto outside_filled = false;
+        auto inside_filled  = false;
+        switch(rule) {
+        case FillRule::NonZero: {
+            auto winding = 0;
+            for(auto j = 0uz; j < polygons.size(); j += 1) {
+                winding += j != i ? winding_number(polygons[j], p) : 0;
+            }
+            outside_filled = winding != 0;
+            inside_filled  = winding + (area > 0 ? 1 : -1) != 0;
+        } break;
+        case FillRule::EvenOdd: {
+            auto depth = 0;
+            for(auto j = 0uz; j < polygons.size(); j += 1) {
+                depth += j != i && contains(polygons[j], p) ? 1 : 0;
+            }
+            outside_filled = depth % 2 == 1;
+            inside_filled  = !outside_filled;
+        } break;
+        }
+        if(inside_filled == outside_filled) {
+            continue;
+        }
+        auto& polygon = polygons[i];
+        if((area > 0) != inside_filled) {
+            std::ranges::reverse(polygon);
+        }
+        (inside_filled ? outers : holes).push_back({std::move(polygon), std::abs(area)});
+    }
+
+    // attach each hole to the smallest outer enclosing it
+    auto children = std::vector<std::vector<Polygon*>>(outers.size());
+    for(auto& hole : holes) {
+        auto parent = outers.size();
+        for(auto i = 0uz; i < outers.size(); i += 1) {
+            if(contains(outers[i].polygon, hole.polygon[0]) && (parent == outers.size() || outers[i].area < outers[parent].area)) {
+                parent = i;
+            }
+        }
+        if(parent != outers.size()) {
+            children[parent].push_back(&hole.polygon);
+        }
+    }
+
+    auto vertices = std::vector<impl::MeshVertex>();
+    auto indices  = std::vector<GLuint>();
+    for(auto i = 0uz; i < outers.size(); i += 1) {
+        auto& polygon = outers[i].polygon;
+        auto& inner   = children[i];
+        std::ranges::sort(inner, std::greater{}, [](const Polygon* hole) { return std::ranges::max(*hole, {}, &Point::x).x; });
+        for(const auto hole : inner) {
+            bridge_hole(polygon, *hole);
+        }
+        ear_clip(polygon, GLuint(vertices.size()), indices);
+        const auto first = vertices.size();
+        vertices.resize(first + polygon.size(), to_vertex({0, 0}));
+        impl::pack_points(polygon, vertices.data() + first, sizeof(impl::MeshVertex));
+    }
+    fill_mesh.upload(vertices, indices);
+    fill_count = indices.size();
+    fill_dirty = false;
+}
+
+auto Path::build_stencil() -> void {
+    const auto polygons = to_polygons(contours);
+
+    auto vertices = std::vector<impl::MeshVertex>();
+    auto indices  = std::vector<GLuint>();
+    auto min      = Point{std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};
+    auto max      = Point{-min.x, -min.y};
+    for(const auto& polygon : polygons) {
+        const auto base = GLuint(vertices.size());
+        for(auto i = 0uz; i < polygon.size(); i += 1) {
+            const auto& p = polygon[i];
+            vertices.push_back(to_vertex(p));
+            min = {std::min(min.x, p.x), std::min(min.y, p.y)};
+            max = {std::max(max.x, p.x), std::max(max.y, p.y)};
+            if(i >= 2) {
+                indices.insert(indices.end(), {base, GLuint(base + i - 1), GLuint(base + i)});
+            }
+        }
+    }
+    stencil_count = indices.size();
+    if(stencil_count != 0) {
+        const auto base = GLuint(vertices.size());
+        for(const auto& p : std::array{min, Point{max.x, min.y}, max, Point{min.x, max.y}}) {
+            vertices.push_back(to_vertex(p));
+        }
+        indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    }
+    stencil_mesh.upload(vertices, indices);
+    stencil_dirty = false;
+}
+
+auto Path::move_to(const Point& point) -> Path& {
+    if(!contours.empty() && !contours.back().closed && contours.back().points.size() == 1) {
+        contours.back().points[0] = point;
+    } else {
+        contours.push_back({.points = {point}});
+    }
+    cursor = point;
+    invalidate();
+    return *this;
+}
+
+auto Path::line_to(const Point& point) -> Path& {
+    current().points.push_back(point);
+    cursor = point;
+    invalidate();
+    return *this;
+}
+
+auto Path::quad_to(const Point& control, const Point& point) -> Path& {
+    const auto p0 = cursor;
+    // chord error is |p0 - 2c + p1| / 4n^2
+    const auto d        = p0 - control * 2 + point;
+    const auto segments = count_segments(std::hypot(d.x, d.y) / 4, tolerance);
+    append_flattened(current().points, segments, [&](const double t) {
+        const auto u = 1 - t;
+        return p0 * (u * u) + control * (2 * u * t) + point * (t * t);
+    });
+    cursor = point;
+    invalidate();
+    return *this;
+}
+
+auto Path::cubic_to(const Point& control1, const Point& control2, const Point& point) -> Path& {
+    const auto p0 = cursor;
+    // chord error is bounded by 3 max(|p0 - 2c1 + c2|, |c1 - 2c2 + p1|) / 4n^2
+    const auto d1       = p0 - control1 * 2 + control2;
+    const auto d2       = control1 - control2 * 2 + point;
+    const auto segments = count_segments(std::max(std::hypot(d1.x, d1.y), std::hypot(d2.x, d2.y)) * 3 / 4, tolerance);
+    append_flattened(current().points, segments, [&](const double t) {
+        const auto u = 1 - t;
+        return p0 * (u * u * u) + control1 * (3 * u * u * t) + control2 * (3 * u * t * t) + point * (t * t * t);
+    });
+    cursor = point;
+    invalidate();
+    return *this;
+}
+
+auto Path::close() -> Path& {
+    if(!contours.empty() && !contours.back().closed) {
+        contours.back().closed = true;
+        cursor                 = contours.back().points.front();
+    }
+    return *this;
+}
+
+auto Path::clear() -> Path& {
+    contours.clear();
+    cursor = {0, 0};
+    invalidate();
+    return *this;
+}
+
+auto Path::set_fill_rule(const FillRule rule) -> Path& {
+    if(this->rule != rule) {
+        this->rule = rule;
+        fill_dirty = true;
+    }
+    return *this;
+}
+
+auto Path::set_tolerance(const double tolerance) -> Path& {
+    this->tolerance = tolerance;
+    return *this;
+}
+
+auto Path::fill(Screen& screen, const Color& color, const Transform& transform) -> void {
+    if(!screen.is_visible(transform.apply(get_bounds()))) {
+        return;
+    }
+    impl::flush_pending_batch();
+    if(const auto recorder = screen.get_recorder()) {
+        recorder->record_call([this, color, transform](Screen& screen) { fill(screen, color, transform); });
+        return;
+    }
+    if(fill_dirty) {
+        build_fill();
+    }
+    if(fill_count == 0) {
+        return;
+    }
+    auto&      gl       = impl::global->mesh_shader;
+    const auto shbinder = gl.use_shader();
+    const auto fbbinder = screen.prepare();
+    gl.set_transform(screen, transform);
+    gl.set_tint(color);
+    fill_mesh.draw_elements(GL_TRIANGLES, 0, fill_count);
+}
+
+auto Path::fill_stencil(Screen& screen, const Color& color, const Transform& transform) -> void {
+    if(!screen.is_visible(transform.apply(get_bounds()))) {
+        return;
+    }
+    impl::flush_pending_batch();
+    if(const auto recorder = screen.get_recorder()) {
+        recorder->record_call([this, color, transform](Screen& screen) { fill_stencil(screen, color, transform); });
+        return;
+    }
+    if(stencil_dirty) {
+        build_stencil();
+    }
+    if(stencil_count == 0) {
+        return;
+    }
+    if(!screen.has_stencil_buffer()) {
+        fill(screen, color, transform);
+        return;
+    }
+    auto&      gl       = impl::global->mesh_shader;
+    const auto shbinder = gl.use_shader();
+    const auto fbbinder = screen.prepare();
+    gl.set_transform(screen, transform);
+    gl.set_tint(color);
+
+    // accumulate the winding of the fans into the stencil
+    auto color_mask = std::array<GLboolean, 4>();
+    glGetBooleanv(GL_COLOR_WRITEMASK, color_mask.data());
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glEnable(GL_STENCIL_TEST);
+    glStencilFunc(GL_ALWAYS, 0, 0xFF);
+    switch(rule) {
+    case FillRule::NonZero:
+        glStencilOpSeparate(GL_FRONT, GL_KEEP, GL_KEEP, GL_INCR_WRAP);
+        glStencilOpSeparate(GL_BACK, GL_KEEP, GL_KEEP, GL_DECR_WRAP);
+        break;
+    case FillRule::EvenOdd:
+        glStencilOp(GL_KEEP, GL_KEEP, GL_INVERT);
+        break;
+    }
+    stencil_mesh.draw_elements(GL_TRIANGLES, 0, stencil_count);
+
+    // cover the bounds, resetting the stencil as it goes
+    glColorMask(color_mask[0], color_mask[1], color_mask[2], color_mask[3]);
+    glStencilFunc(GL_NOTEQUAL, 0, 0xFF);
+    glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
+    stencil_mesh.draw_elements(GL_TRIANGLES, stencil_count, 6);
+    glDisable(GL_STENCIL_TEST);
+}
+
+auto Path::stroke(Screen& screen, const Color& color, const LineStyle& style, const Transform& transform) -> void {
+    auto line  = style;
+    line.width = style.width * transform.get_scale();
+    if(!screen.is_visible(transform.apply(get_bounds()).expand(line.width, line.width))) {
+        return;
+    }
+    auto buf   = std::vector<Point>();
+    for(const auto& contour : contours) {
+        buf.resize(contour.points.size());
+        std::ranges::transform(contour.points, buf.begin(), [&](const Point& p) { return transform.apply(p); });
+        line.closed = contour.closed;
+        draw_polyline(screen, buf, color, line);
+    }
+}
+} // namespace gawl
@@ -0,0 +1,67 @@
+#pragma once
+#include <optional>
+#include <vector>
+
+#include "color.hpp"
+#include "mesh-shader.hpp"
+#include "polyline.hpp"
+#include "screen.hpp"
+#include "transform.hpp"
+
+namespace gawl {
+enum class FillRule {
+    NonZero,
+    EvenOdd,
+};
+
+// retained vector path
+// curves are flattened when added, fill geometry is built on the first draw and kept on the gpu until the path is modified
+class Path {
+  private:
+    struct Contour {
+        std::vector<Point> points;
+        bool               closed = false;
+    };
+
+    std::vector<Contour> contours;
+    Point                cursor    = {0, 0};
+    FillRule             rule      = FillRule::NonZero;
+    double               tolerance = 0.25;
+
+    impl::MeshBuffer fill_mesh;
+    size_t           fill_count = 0;
+    bool             fill_dirty = true;
+
+    impl::MeshBuffer stencil_mesh;
+    size_t           stencil_count = 0; // the cover quad follows
+    bool             stencil_dirty = true;
+
+    std::optional<Rectangle> bounds; // of all contours, nullopt until requested after a modification
+
+    auto current() -> Contour&;
+    auto invalidate() -> void;
+    auto get_bounds() -> const Rectangle&;
+    auto build_fill() -> void;
+    auto build_stencil() -> void;
+
+  public:
+    auto move_to(const Point& point) -> Path&;
+    auto line_to(const Point& point) -> Path&;
+    auto quad_to(const Point& control, const Point& point) -> Path&;
+    auto cubic_to(const Point& control1, const Point& control2, const Point& point) -> Path&;
+    auto close() -> Path&;
+    auto clear() -> Path&;
+    auto set_fill_rule(FillRule rule) -> Path&;
+    // maximum distance between a curve and its flattened segments, in path units
+    auto set_tolerance(double tolerance) -> Path&;
+
+    // tessellated fill, open contours are closed implicitly
+    // contours must not intersect themselves or each other, use fill_stencil() for such paths
+    auto fill(Screen& screen, const Color& color, const Transform& transform = {}) -> void;
+    // stencil-then-cover fill, handles any path without tessellation
+    // needs a stencil buffer, falls back to fill() on screens without it
+    auto fill_stencil(Screen& screen, const Color& color, const Transform& transform = {}) -> void;
+    // style.closed is ignored, each contour is stroked as closed by close()
+    auto stroke(Screen& screen, const Color& color, const LineStyle& style = {}, const Transform& transform = {}) -> void;
+};
+} // namespace gawl
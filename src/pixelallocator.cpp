@@ -0,0 +1,114 @@
+#include <bit>
+#include <new>
+
+#include <sys/mman.h>
+
+#include "macros/assert.hpp"
+#include "pixelallocator.hpp"
+
+namespace gawl {
+namespace {
+constexpr auto min_class_size = size_t(64 * 1024);
+constexpr auto huge_page_size = size_t(2 * 1024 * 1024);
+
+auto get_class(const size_t size) -> size_t {
+    return std::bit_width(std::max(size, min_class_size) - 1);
+}
+
+struct GlobalAllocator {
+    std::mutex                      mutex;
+    std::shared_ptr<PixelAllocator> allocator = std::make_shared<DefaultPixelAllocator>();
+};
+
+auto get_global() -> GlobalAllocator& {
+    static auto global = GlobalAllocator();
+    return global;
+}
+} // namespace
+
+auto DefaultPixelAllocator::allocate(const size_t size) -> std::byte* {
+    return (std::byte*)(::operator new(size, std::nothrow));
+}
+
+auto DefaultPixelAllocator::deallocate(std::byte* const ptr, const size_t /*size*/) -> void {
+    ::operator delete(ptr, std::nothrow);
+}
+
+auto PooledPixelAllocator::map(const size_t size) -> std::byte* {
+    if(config.huge_pages && size >= huge_page_size) {
+        if(const auto ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0); ptr != MAP_FAILED) {
+            return (std::byte*)(ptr);
+        }
+    }
+    const auto ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(ptr == MAP_FAILED) {
+        return nullptr;
+    }
+    if(config.huge_pages) {
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+    return (std::byte*)(ptr);
+}
+
+auto PooledPixelAllocator::allocate(const size_t size) -> std::byte* {
+    const auto index = get_class(size);
+    {
+        auto  lock = std::lock_guard(mutex);
+        auto& list = classes[index];
+        if(!list.empty()) {
+            const auto ptr = list.back();
+            list.pop_back();
+            cached -= 1uz << index;
+            return ptr;
+        }
+    }
+    return map(1uz << index);
+}
+
+auto PooledPixelAllocator::deallocate(std::byte* const ptr, const size_t size) -> void {
+    const auto index      = get_class(size);
+    const auto class_size = 1uz << index;
+    {
+        auto lock = std::lock_guard(mutex);
+        if(cached + class_size <= config.max_cached_bytes) {
+            classes[index].push_back(ptr);
+            cached += class_size;
+            return;
+        }
+    }
+    munmap(ptr, class_size);
+}
+
+auto PooledPixelAllocator::trim() -> void {
+    auto lock = std::lock_guard(mutex);
+    for(auto index = 0uz; index < classes.size(); index += 1) {
+        for(const auto ptr : classes[index]) {
+            munmap(ptr, 1uz << index);
+        }
+        classes[index].clear();
+    }
+    cached = 0;
+}
+
+PooledPixelAllocator::PooledPixelAllocator(const Config config)
+    : config(config) {}
+
+PooledPixelAllocator::PooledPixelAllocator()
+    : PooledPixelAllocator(Config()) {}
+
+PooledPixelAllocator::~PooledPixelAllocator() {
+    trim();
+}
+
+auto set_pixel_allocator(std::shared_ptr<PixelAllocator> allocator) -> void {
+    auto& global = get_global();
+    auto  lock   = std::lock_guard(global.mutex);
+    global.allocator = std::move(allocator);
+}
+
+auto get_pixel_allocator() -> std::shared_ptr<PixelAllocator> {
+    auto& global = get_global();
+    auto  lock   = std::lock_guard(global.mutex);
+    return global.allocator;
+}
+} // namespace gawl
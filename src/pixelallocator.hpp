@@ -0,0 +1,56 @@
+#pragma once
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace gawl {
+// allocator for heap backed PixelStorage
+// returned memory is not initialized, nullptr on failure
+class PixelAllocator {
+  public:
+    virtual auto allocate(size_t size) -> std::byte* = 0;
+    virtual auto deallocate(std::byte* ptr, size_t size) -> void = 0;
+
+    virtual ~PixelAllocator() {}
+};
+
+class DefaultPixelAllocator : public PixelAllocator {
+  public:
+    auto allocate(size_t size) -> std::byte* override;
+    auto deallocate(std::byte* ptr, size_t size) -> void override;
+};
+
+// recycles freed buffers in power-of-two size classes
+// buffers are mmap-ed, so the unused tail of a size class never gets faulted in
+class PooledPixelAllocator : public PixelAllocator {
+  public:
+    struct Config {
+        size_t max_cached_bytes = 256 * 1024 * 1024;
+        // MAP_HUGETLB if reserved, otherwise transparent huge pages
+        bool huge_pages = false;
+    };
+
+  private:
+    Config                                  config;
+    std::mutex                              mutex;
+    std::array<std::vector<std::byte*>, 64> classes;
+    size_t                                  cached = 0;
+
+    auto map(size_t size) -> std::byte*;
+
+  public:
+    auto allocate(size_t size) -> std::byte* override;
+    auto deallocate(std::byte* ptr, size_t size) -> void override;
+    // return cached buffers to the system
+    auto trim() -> void;
+
+    PooledPixelAllocator(Config config);
+    PooledPixelAllocator();
+    ~PooledPixelAllocator();
+};
+
+// used by PixelStorage::create, thread safe
+auto set_pixel_allocator(std::shared_ptr<PixelAllocator> allocator) -> void;
+auto get_pixel_allocator() -> std::shared_ptr<PixelAllocator>;
+} // namespace gawl
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cstring>
 
 #include <ImageMagick-7/Magick++.h>
@@ -7,49 +8,82 @@
 #include "pixelbuffer.hpp"
 
 namespace gawl {
-auto load_texture_imagemagick(Magick::Image&& image) -> PixelBuffer {
+namespace {
+auto load_texture_imagemagick(Magick::Image&& image, const PixelStorageType storage) -> std::optional<PixelBuffer> {
     const auto width  = image.columns();
     const auto height = image.rows();
-    auto       data   = std::vector<std::byte>(width * height * 4);
+    unwrap_mut(data, PixelStorage::create(width * height * 4, storage));
     image.write(0, 0, width, height, "RGBA", Magick::CharPixel, data.data());
 
     return PixelBuffer{width, height, std::move(data)};
 }
+} // namespace
+
+auto PixelBuffer::downscale_half() const -> PixelBuffer {
+    const auto w   = (width + 1) / 2;
+    const auto h   = (height + 1) / 2;
+    auto       ret = PixelBuffer{w, h, PixelStorage(w * h * 4)};
+    for(auto y = 0uz; y < h; y += 1) {
+        const auto y0 = y * 2;
+        const auto y1 = std::min(y0 + 1, height - 1);
+        for(auto x = 0uz; x < w; x += 1) {
+            const auto x0 = x * 2;
+            const auto x1 = std::min(x0 + 1, width - 1);
+            for(auto c = 0uz; c < 4; c += 1) {
+                const auto sum = uint32_t(data[(y0 * width + x0) * 4 + c]) +
+                                 uint32_t(data[(y0 * width + x1) * 4 + c]) +
+                                 uint32_t(data[(y1 * width + x0) * 4 + c]) +
+                                 uint32_t(data[(y1 * width + x1) * 4 + c]);
+                ret.data[(y * w + x) * 4 + c] = std::byte((sum + 2) / 4);
+            }
+        }
+    }
+    return ret;
+}
+
+auto PixelBuffer::crop(const std::array<int, 4>& rect) const -> PixelBuffer {
+    const auto [x, y, w, h] = rect;
+    auto ret                = PixelBuffer{size_t(w), size_t(h), PixelStorage(w * h * 4)};
+    for(auto row = 0; row < h; row += 1) {
+        std::memcpy(ret.data.data() + row * w * 4, data.data() + ((y + row) * width + x) * 4, w * 4);
+    }
+    return ret;
+}
 
 auto PixelBuffer::from_raw(const size_t width, const size_t height, const std::byte* const buffer) -> PixelBuffer {
     const auto len = size_t(width * height * 4);
 
-    auto data = std::vector<std::byte>(len);
+    auto data = PixelStorage(len);
     std::memcpy(data.data(), buffer, len);
 
     return PixelBuffer{width, height, std::move(data)};
 }
 
-auto PixelBuffer::from_file(const char* const file) -> std::optional<PixelBuffer> {
+auto PixelBuffer::from_file(const char* const file, const PixelStorageType storage) -> std::optional<PixelBuffer> {
     // ImageMagick 7.1.0-44 can't decode grayscale jxl image properly
     // hook and decode it by hand
     if(std::string_view(file).ends_with(".jxl")) {
-        unwrap_mut(jxl, impl::jxl::decode_jxl(file));
+        unwrap_mut(jxl, impl::jxl::decode_jxl(file, std::thread::hardware_concurrency(), storage));
         return PixelBuffer{jxl.width, jxl.height, std::move(jxl.frames[0].buffer)};
     }
 
     try {
-        return load_texture_imagemagick(Magick::Image(file));
+        return load_texture_imagemagick(Magick::Image(file), storage);
     } catch(const Magick::Exception& e) {
         bail("imagemagick error: {}", e.what());
     }
 }
 
-auto PixelBuffer::from_blob(const std::byte* const data, const size_t size) -> std::optional<PixelBuffer> {
+auto PixelBuffer::from_blob(const std::byte* const data, const size_t size, const PixelStorageType storage) -> std::optional<PixelBuffer> {
     try {
         auto blob = Magick::Blob(data, size);
-        return load_texture_imagemagick(Magick::Image(blob));
+        return load_texture_imagemagick(Magick::Image(blob), storage);
     } catch(const Magick::Exception& e) {
         bail("imagemagick error: {}", e.what());
     }
 }
 
-auto PixelBuffer::from_blob(const std::span<const std::byte> buffer) -> std::optional<PixelBuffer> {
-    return from_blob(buffer.data(), buffer.size());
+auto PixelBuffer::from_blob(const std::span<const std::byte> buffer, const PixelStorageType storage) -> std::optional<PixelBuffer> {
+    return from_blob(buffer.data(), buffer.size(), storage);
 }
 } // namespace gawl
@@ -1,17 +1,24 @@
 #pragma once
+#include <array>
 #include <optional>
 #include <span>
 #include <vector>
 
+#include "pixelstorage.hpp"
+
 namespace gawl {
 struct PixelBuffer {
-    size_t                 width;
-    size_t                 height;
-    std::vector<std::byte> data;
+    size_t       width;
+    size_t       height;
+    PixelStorage data;
+
+    auto downscale_half() const -> PixelBuffer; // 2x2 box filter
+    auto crop(const std::array<int, 4>& rect) const -> PixelBuffer;
 
     static auto from_raw(size_t width, size_t height, const std::byte* buffer) -> PixelBuffer;
-    static auto from_file(const char* file) -> std::optional<PixelBuffer>;
-    static auto from_blob(const std::byte* data, size_t size) -> std::optional<PixelBuffer>;
-    static auto from_blob(std::span<const std::byte> buffer) -> std::optional<PixelBuffer>;
+    // PixelStorageType::Shared decodes directly into a memfd, see decode-worker.hpp
+    static auto from_file(const char* file, PixelStorageType storage = PixelStorageType::Heap) -> std::optional<PixelBuffer>;
+    static auto from_blob(const std::byte* data, size_t size, PixelStorageType storage = PixelStorageType::Heap) -> std::optional<PixelBuffer>;
+    static auto from_blob(std::span<const std::byte> buffer, PixelStorageType storage = PixelStorageType::Heap) -> std::optional<PixelBuffer>;
 };
 } // namespace gawl
@@ -0,0 +1,172 @@
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "macros/assert.hpp"
+#include "pixelstorage.hpp"
+
+namespace gawl {
+auto PixelStorage::release() -> void {
+    if(allocator) {
+        allocator->deallocate(ptr, length);
+        allocator.reset();
+    } else if(ptr != nullptr) {
+        munmap(ptr, length);
+    }
+    if(fd != -1) {
+        close(fd);
+        fd = -1;
+    }
+    ptr    = nullptr;
+    length = 0;
+}
+
+auto PixelStorage::create(const size_t size, const PixelStorageType type) -> std::optional<PixelStorage> {
+    if(type == PixelStorageType::Heap) {
+        auto ret = PixelStorage();
+        if(size == 0) {
+            return ret;
+        }
+        ret.allocator = get_pixel_allocator();
+        ret.ptr       = ret.allocator->allocate(size);
+        if(ret.ptr == nullptr) {
+            ret.allocator.reset();
+            bail("failed to allocate {} bytes of pixels", size);
+        }
+        ret.length = size;
+        return ret;
+    }
+    const auto fd = memfd_create("gawl-pixels", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    ensure(fd != -1);
+    if(ftruncate(fd, size) != 0) {
+        close(fd);
+        bail("failed to resize memfd");
+    }
+    return from_fd(fd, size);
+}
+
+auto PixelStorage::from_fd(const int fd, const size_t size, const bool writable) -> std::optional<PixelStorage> {
+    auto ret = PixelStorage();
+    ret.fd   = fd;
+    if(size == 0) {
+        return ret;
+    }
+    const auto ptr = mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    ensure(ptr != MAP_FAILED);
+    ret.ptr    = (std::byte*)(ptr);
+    ret.length = size;
+    return ret;
+}
+
+auto PixelStorage::data() -> std::byte* {
+    return ptr;
+}
+
+auto PixelStorage::data() const -> const std::byte* {
+    return ptr;
+}
+
+auto PixelStorage::size() const -> size_t {
+    return length;
+}
+
+auto PixelStorage::empty() const -> bool {
+    return length == 0;
+}
+
+auto PixelStorage::begin() -> std::byte* {
+    return ptr;
+}
+
+auto PixelStorage::begin() const -> const std::byte* {
+    return ptr;
+}
+
+auto PixelStorage::end() -> std::byte* {
+    return ptr + length;
+}
+
+auto PixelStorage::end() const -> const std::byte* {
+    return ptr + length;
+}
+
+auto PixelStorage::get_type() const -> PixelStorageType {
+    return fd != -1 ? PixelStorageType::Shared : PixelStorageType::Heap;
+}
+
+auto PixelStorage::get_fd() const -> int {
+    return fd;
+}
+
+auto PixelStorage::seal() -> bool {
+    ensure(fd != -1, "heap storage cannot be sealed");
+    // F_SEAL_WRITE fails while writable shared mappings exist
+    const auto size = std::exchange(length, 0);
+    if(ptr != nullptr) {
+        munmap(std::exchange(ptr, nullptr), size);
+    }
+    ensure(fcntl(fd, F_ADD_SEALS, F_SEAL_SEAL | F_SEAL_WRITE | F_SEAL_SHRINK | F_SEAL_GROW) == 0);
+    if(size != 0) {
+        const auto p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ensure(p != MAP_FAILED);
+        ptr    = (std::byte*)(p);
+        length = size;
+    }
+    return true;
+}
+
+auto PixelStorage::operator[](const size_t i) -> std::byte& {
+    return ptr[i];
+}
+
+auto PixelStorage::operator[](const size_t i) const -> const std::byte& {
+    return ptr[i];
+}
+
+auto PixelStorage::operator=(const PixelStorage& o) -> PixelStorage& {
+    if(this != &o) {
+        auto copy = PixelStorage(o.length);
+        if(o.length != 0) {
+            std::memcpy(copy.ptr, o.ptr, o.length);
+        }
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+auto PixelStorage::operator=(PixelStorage&& o) -> PixelStorage& {
+    if(this != &o) {
+        release();
+        allocator = std::move(o.allocator);
+        ptr       = std::exchange(o.ptr, nullptr);
+        length    = std::exchange(o.length, 0);
+        fd        = std::exchange(o.fd, -1);
+    }
+    return *this;
+}
+
+PixelStorage::PixelStorage(const size_t size) {
+    if(size == 0) {
+        return;
+    }
+    allocator = get_pixel_allocator();
+    ptr       = allocator->allocate(size);
+    ASSERT(ptr != nullptr, "failed to allocate {} bytes of pixels", size);
+    length = size;
+}
+
+PixelStorage::PixelStorage(const PixelStorage& o) {
+    *this = o;
+}
+
+PixelStorage::PixelStorage(PixelStorage&& o) {
+    *this = std::move(o);
+}
+
+PixelStorage::~PixelStorage() {
+    release();
+}
+} // namespace gawl
@@ -0,0 +1,56 @@
+#pragma once
+#include <memory>
+#include <optional>
+
+#include "pixelallocator.hpp"
+
+namespace gawl {
+enum class PixelStorageType {
+    Heap,
+    Shared, // memfd, can be passed to other processes
+};
+
+class PixelStorage {
+  private:
+    std::shared_ptr<PixelAllocator> allocator; // null if shared
+    std::byte*                      ptr    = nullptr;
+    size_t                          length = 0;
+    int                             fd     = -1;
+
+    auto release() -> void;
+
+  public:
+    // contents are not initialized, nullopt if out of memory
+    static auto create(size_t size, PixelStorageType type = PixelStorageType::Heap) -> std::optional<PixelStorage>;
+    // takes ownership of the fd
+    // read-only storage must not be written through data() or operator[]
+    static auto from_fd(int fd, size_t size, bool writable = true) -> std::optional<PixelStorage>;
+
+    auto data() -> std::byte*;
+    auto data() const -> const std::byte*;
+    auto size() const -> size_t;
+    auto empty() const -> bool;
+    auto begin() -> std::byte*;
+    auto begin() const -> const std::byte*;
+    auto end() -> std::byte*;
+    auto end() const -> const std::byte*;
+    auto get_type() const -> PixelStorageType;
+    auto get_fd() const -> int; // -1 if on heap
+    // makes shared storage immutable with file seals, so that receivers of the fd can trust its contents
+    // the storage becomes read-only
+    auto seal() -> bool;
+
+    auto operator[](size_t i) -> std::byte&;
+    auto operator[](size_t i) const -> const std::byte&;
+    auto operator=(const PixelStorage& o) -> PixelStorage&; // always copied to heap
+    auto operator=(PixelStorage&& o) -> PixelStorage&;
+
+    PixelStorage() = default;
+    // uninitialized heap storage from the current pixel allocator
+    // aborts if out of memory, decoders should use create() instead
+    explicit PixelStorage(size_t size);
+    PixelStorage(const PixelStorage& o);
+    PixelStorage(PixelStorage&& o);
+    ~PixelStorage();
+};
+} // namespace gawl
@@ -1,15 +1,28 @@
 #pragma once
-#include <vector>
-
 #include "shader.hpp"
+#include "vertex-layout.hpp"
 
 namespace gawl::impl {
+struct PolygonVertex {
+    GLfloat x;
+    GLfloat y;
+    GLubyte color[4];
+};
+
 class PolygonShader : public Shader {
   private:
-    size_t vbo_capacity = 0;
+    using Layout = VertexLayout<Attribute<"position", &PolygonVertex::x, &PolygonVertex::y>,
+                                Attribute<"vertex_color", &PolygonVertex::color>>;
+
+    Layout      layout;
+    UniformMat3 transform;
 
   public:
-    auto write_buffer(const std::vector<GLfloat>& buffer) -> void;
+    // the shader must be in use
+    auto set_transform(const MetaScreen& screen, const Transform& transform = {}) -> void;
+    // the vertex array must be bound
+    // offset is the byte offset of the first vertex in the bound array buffer
+    auto set_vertices(size_t offset) -> void;
     auto init() -> bool;
 };
 } // namespace gawl::impl
@@ -1,54 +1,111 @@
 #include <cmath>
 #include <numbers>
 
+#include "batch.hpp"
 #include "global.hpp"
 #include "polygon-shader.hpp"
 #include "polygon.hpp"
+#include "polyline.hpp"
+#include "recorder.hpp"
 
 namespace gawl::impl {
 namespace {
-template <GLenum mode>
-auto generic_draw(Screen& screen, const std::span<const Point> vertices, const Color& color) -> void {
-    auto        buffer = std::vector<GLfloat>(vertices.size() * 2);
-    auto&       gl     = global->polygon_shader;
-    const auto& s      = screen.get_viewport();
-    const auto  scale  = screen.get_scale();
-    for(auto i = 0uz; i < vertices.size(); i += 1) {
-        auto x            = vertices[i].x * scale;
-        auto y            = vertices[i].y * scale;
-        buffer[i * 2 + 0] = ((x - s.base[0]) * 2 - s.size[0]) / static_cast<int>(s.size[0]);
-        buffer[i * 2 + 1] = ((y - s.base[1]) * 2 - s.size[1]) / -static_cast<int>(s.size[1]);
+enum class Topology {
+    Triangles,
+    Fan,
+};
+
+// merges polygons into GL_TRIANGLES draws with per-vertex color
+class PolygonBatch : public Batcher {
+  private:
+    Screen*                    screen = nullptr;
+    std::vector<PolygonVertex> vertices;
+
+  public:
+    auto append(Screen& screen, const Topology topology, const std::span<const Point> points, const Color& color) -> void {
+        if(!screen.is_visible(bounding_box(points))) {
+            return;
+        }
+        if(this->screen != &screen) {
+            flush();
+            this->screen = &screen;
+        }
+        set_pending_batch(this);
+
+        const auto rgba = to_rgba8(color);
+        const auto push = [&](const Point& point) {
+            vertices.push_back({GLfloat(point.x), GLfloat(point.y), {rgba[0], rgba[1], rgba[2], rgba[3]}});
+        };
+
+        switch(topology) {
+        case Topology::Triangles: {
+            const auto first = vertices.size();
+            const auto count = points.size() / 3 * 3;
+            vertices.resize(first + count);
+            pack_points(points.first(count), vertices.data() + first, sizeof(PolygonVertex));
+            for(auto& v : std::span(vertices).subspan(first)) {
+                std::ranges::copy(rgba, v.color);
+            }
+        } break;
+        case Topology::Fan:
+            for(auto i = 2uz; i < points.size(); i += 1) {
+                push(points[0]);
+                push(points[i - 1]);
+                push(points[i]);
+            }
+            break;
+        }
     }
-    const auto vabinder = gl.bind_vao();
-    const auto shbinder = gl.use_shader();
-    const auto vbbinder = gl.bind_vbo();
-    const auto fbbinder = screen.prepare();
 
-    gl.write_buffer(buffer);
+    auto flush() -> void override {
+        forget_pending_batch(this);
+        if(vertices.empty()) {
+            return;
+        }
+        if(const auto recorder = screen->get_recorder()) {
+            recorder->record(RecordKind::Polygons, vertices.data(), vertices.size(), sizeof(PolygonVertex));
+            vertices.clear();
+            return;
+        }
+        auto&      gl       = global->polygon_shader;
+        const auto offset   = global->vertex_ring.write(vertices.data(), vertices.size() * sizeof(PolygonVertex), sizeof(PolygonVertex));
+        const auto vabinder = gl.bind_vao();
+        const auto vbbinder = global->vertex_ring.bind();
+        const auto shbinder = gl.use_shader();
+        const auto fbbinder = screen->prepare();
+        gl.set_vertices(offset);
+        gl.set_transform(*screen);
+        glDrawArrays(GL_TRIANGLES, 0, GLsizei(vertices.size()));
+        vertices.clear();
+    }
+
+    ~PolygonBatch() {
+        forget_pending_batch(this);
+    }
+};
 
-    glUniform4f(glGetUniformLocation(shbinder.get(), "polygon_color"), color[0], color[1], color[2], color[3]);
-    glDrawArrays(mode, 0, buffer.size() / 2);
+auto get_batch() -> PolygonBatch& {
+    static thread_local auto batch = PolygonBatch();
+    return batch;
 }
 } // namespace
 } // namespace gawl::impl
 
 namespace gawl {
 auto draw_polygon(Screen& screen, const std::span<const Point> vertices, const Color& color) -> void {
-    impl::generic_draw<GL_TRIANGLES>(screen, vertices, color);
+    impl::get_batch().append(screen, impl::Topology::Triangles, vertices, color);
 }
 
 auto draw_polygon_fan(Screen& screen, const std::span<const Point> vertices, const Color& color) -> void {
-    impl::generic_draw<GL_TRIANGLE_FAN>(screen, vertices, color);
+    impl::get_batch().append(screen, impl::Topology::Fan, vertices, color);
 }
 
 auto draw_lines(Screen& screen, const std::span<const Point> vertices, const Color& color, const GLfloat width) -> void {
-    glLineWidth(width * screen.get_scale());
-    impl::generic_draw<GL_LINE_STRIP>(screen, vertices, color);
+    draw_polyline(screen, vertices, color, {.width = width});
 }
 
 auto draw_outlines(Screen& screen, const std::span<const Point> vertices, const Color& color, const GLfloat width) -> void {
-    glLineWidth(width * screen.get_scale());
-    impl::generic_draw<GL_LINE_LOOP>(screen, vertices, color);
+    draw_polyline(screen, vertices, color, {.width = width, .closed = true});
 }
 
 auto triangulate_circle_angle(const Point& point, const double radius, const std::pair<double, double>& angle) -> std::vector<Point> {
@@ -0,0 +1,50 @@
+#include <cstddef>
+
+#include "macros/assert.hpp"
+#include "polyline-shader.hpp"
+#include "shader-source.hpp"
+
+namespace gawl::impl {
+auto PolylineShader::set_points(const size_t offset) -> void {
+    for(const auto& attrib : attribs) {
+        glVertexAttribPointer(attrib.location, attrib.size, attrib.type, attrib.normalized, sizeof(PolylinePoint), (void*)(offset + attrib.offset));
+    }
+}
+
+auto PolylineShader::set_transform(const MetaScreen& screen) -> void {
+    transform.set(to_ndc_matrix(screen));
+    scale.set(screen.get_scale());
+}
+
+auto PolylineShader::init() -> bool {
+    ensure(Shader::init(polyline_vertex_shader_source, polyline_fragment_shader_source));
+    ensure(transform.init(shader_program, "transform"));
+    ensure(scale.init(shader_program, "scale"));
+    const auto vabinder = bind_vao();
+
+    constexpr auto stride = sizeof(PolylinePoint);
+    constexpr auto pos    = offsetof(PolylinePoint, x);
+    constexpr auto width  = offsetof(PolylinePoint, half_width);
+    constexpr auto color  = offsetof(PolylinePoint, color);
+    constexpr auto style  = offsetof(PolylinePoint, style);
+    // instance i reads points i, i + 1, i + 2 and i + 3
+    attribs = {{
+        {-1, 2, GL_FLOAT, GL_FALSE, pos, "prev"},
+        {-1, 4, GL_UNSIGNED_BYTE, GL_FALSE, style, "prev_style"},
+        {-1, 2, GL_FLOAT, GL_FALSE, stride + pos, "point_a"},
+        {-1, 1, GL_FLOAT, GL_FALSE, stride + width, "half_width"},
+        {-1, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride + color, "color_a"},
+        {-1, 4, GL_UNSIGNED_BYTE, GL_FALSE, stride + style, "style_a"},
+        {-1, 2, GL_FLOAT, GL_FALSE, stride * 2 + pos, "point_b"},
+        {-1, 2, GL_FLOAT, GL_FALSE, stride * 3 + pos, "next"},
+        {-1, 4, GL_UNSIGNED_BYTE, GL_FALSE, stride * 3 + style, "next_style"},
+    }};
+    for(auto& attrib : attribs) {
+        attrib.location = glGetAttribLocation(shader_program, attrib.name);
+        ensure(attrib.location != -1, "no such attribute {}", attrib.name);
+        glEnableVertexAttribArray(attrib.location);
+        glVertexAttribDivisor(attrib.location, 1);
+    }
+    return true;
+}
+} // namespace gawl::impl
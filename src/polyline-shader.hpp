@@ -0,0 +1,47 @@
+#pragma once
+#include <array>
+
+#include "shader.hpp"
+
+namespace gawl::impl {
+struct PolylinePoint {
+    enum Flags : GLubyte {
+        Padding      = 1 << 0, // marks line ends, never drawn
+        SegmentStart = 1 << 1, // draw the segment to the next point
+    };
+
+    GLfloat x; // in screen coordinates
+    GLfloat y;
+    GLfloat half_width;
+    GLubyte color[4];
+    GLubyte style[4]; // flags, join, cap, unused
+};
+
+// thick lines expanded on the gpu, one instance per point
+class PolylineShader : public Shader {
+  private:
+    struct Attrib {
+        GLint       location;
+        GLint       size;
+        GLenum      type;
+        GLboolean   normalized;
+        size_t      offset;
+        const char* name;
+    };
+
+    std::array<Attrib, 9> attribs;
+    UniformMat3           transform;
+    UniformFloat          scale;
+
+  public:
+    // vertices per instance
+    static constexpr auto instance_vertices = 18;
+
+    // the vertex array and the shader must be bound
+    // offset is the byte offset of the first point in the bound array buffer
+    auto set_points(size_t offset) -> void;
+    // the shader must be in use
+    auto set_transform(const MetaScreen& screen) -> void;
+    auto init() -> bool;
+};
+} // namespace gawl::impl
@@ -0,0 +1,118 @@
+#include <vector>
+
+#include "batch.hpp"
+#include "global.hpp"
+#include "polyline.hpp"
+#include "recorder.hpp"
+
+namespace gawl {
+namespace {
+class PolylineBatch : public impl::Batcher {
+  private:
+    Screen*                          screen = nullptr;
+    std::vector<impl::PolylinePoint> points;
+    std::vector<Point>               unique; // scratch for append()
+
+  public:
+    auto append(Screen& screen, const std::span<const Point> input, const Color& color, const LineStyle& style) -> void {
+        if(input.size() < 2) {
+            return;
+        }
+        if(!screen.is_visible(bounding_box(input).expand(style.width, style.width))) {
+            return;
+        }
+
+        // zero length segments have no direction and would produce bogus joins
+        const auto same = [](const Point& a, const Point& b) {
+            return GLfloat(a.x) == GLfloat(b.x) && GLfloat(a.y) == GLfloat(b.y);
+        };
+        unique.clear();
+        for(const auto& p : input) {
+            if(unique.empty() || !same(unique.back(), p)) {
+                unique.push_back(p);
+            }
+        }
+        if(style.closed && unique.size() > 1 && same(unique.back(), unique.front())) {
+            unique.pop_back();
+        }
+        if(unique.size() < 2) {
+            return;
+        }
+        const auto vertices = std::span<const Point>(unique);
+
+        if(this->screen != &screen) {
+            flush();
+            this->screen = &screen;
+        }
+        impl::set_pending_batch(this);
+
+        using Flags     = impl::PolylinePoint::Flags;
+        const auto rgba = impl::to_rgba8(color);
+        const auto push = [&](const Point& p, const GLubyte flags) {
+            points.push_back({
+                .x          = GLfloat(p.x),
+                .y          = GLfloat(p.y),
+                .half_width = GLfloat(style.width / 2),
+                .color      = {rgba[0], rgba[1], rgba[2], rgba[3]},
+                .style      = {flags, GLubyte(style.join), GLubyte(style.cap), 0},
+            });
+        };
+
+        // the instance of a point reads the previous one and the next two
+        // open:   pad, v0 ... vn-1, pad
+        // closed: vn-1, v0 ... vn-1, v0, v1
+        const auto n = vertices.size();
+        if(style.closed) {
+            push(vertices[n - 1], 0);
+            for(const auto& v : vertices) {
+                push(v, Flags::SegmentStart);
+            }
+            push(vertices[0], 0);
+            push(vertices[1], 0);
+        } else {
+            push(vertices[0], Flags::Padding);
+            for(auto i = 0uz; i < n; i += 1) {
+                push(vertices[i], i + 1 < n ? Flags::SegmentStart : 0);
+            }
+            push(vertices[n - 1], Flags::Padding);
+        }
+    }
+
+    auto flush() -> void override {
+        impl::forget_pending_batch(this);
+        if(points.size() < 4) {
+            points.clear();
+            return;
+        }
+        if(const auto recorder = screen->get_recorder()) {
+            recorder->record(impl::RecordKind::Polyline, points.data(), points.size(), sizeof(impl::PolylinePoint));
+            points.clear();
+            return;
+        }
+        auto&      gl       = impl::global->polyline_shader;
+        const auto offset   = impl::global->vertex_ring.write(points.data(), points.size() * sizeof(impl::PolylinePoint), sizeof(impl::PolylinePoint));
+        const auto vabinder = gl.bind_vao();
+        const auto vbbinder = impl::global->vertex_ring.bind();
+        const auto shbinder = gl.use_shader();
+        const auto fbbinder = screen->prepare();
+        gl.set_points(offset);
+        gl.set_transform(*screen);
+        glDrawArraysInstanced(GL_TRIANGLES, 0, impl::PolylineShader::instance_vertices, GLsizei(points.size() - 3));
+        points.clear();
+    }
+
+    ~PolylineBatch() {
+        impl::forget_pending_batch(this);
+    }
+};
+
+auto get_polyline_batch() -> PolylineBatch& {
+    static thread_local auto batch = PolylineBatch();
+    return batch;
+}
+} // namespace
+
+auto draw_polyline(Screen& screen, const std::span<const Point> vertices, const Color& color, const LineStyle& style) -> void {
+    get_polyline_batch().append(screen, vertices, color, style);
+}
+} // namespace gawl
@@ -0,0 +1,30 @@
+#pragma once
+#include <span>
+
+#include "color.hpp"
+#include "screen.hpp"
+
+namespace gawl {
+enum class LineJoin {
+    Miter, // falls back to bevel on sharp corners
+    Bevel,
+    Round,
+};
+
+enum class LineCap {
+    Butt,
+    Square,
+    Round,
+};
+
+struct LineStyle {
+    double   width  = 1;
+    LineJoin join   = LineJoin::Miter;
+    LineCap  cap    = LineCap::Butt;
+    bool     closed = false;
+};
+
+// antialiased thick line, segments are expanded on the gpu from the points
+// consecutive calls are batched into one draw
+auto draw_polyline(Screen& screen, std::span<const Point> vertices, const Color& color, const LineStyle& style = {}) -> void;
+} // namespace gawl
@@ -0,0 +1,26 @@
+#pragma once
+#include <functional>
+
+#include "screen.hpp"
+
+namespace gawl::impl {
+enum class RecordKind {
+    Polygons, // PolygonVertex
+    Sprites,  // SpriteVertex, 4 per quad
+    Glyphs,   // SpriteVertex, alpha masks tinted by the vertex color
+    Rects,    // RectInstance
+    Shapes,   // ShapeInstance
+    Polyline, // PolylinePoint
+};
+
+// receives the resolved draws of a recording screen
+// batchers hand over their vertices instead of drawing them when the screen has a recorder
+class Recorder {
+  public:
+    virtual auto record(RecordKind kind, const void* data, size_t count, size_t stride, GLuint texture = 0) -> void = 0;
+    // for draws of retained gpu objects, invoked with the screen at replay
+    virtual auto record_call(std::function<void(Screen&)> call) -> void = 0;
+
+    virtual ~Recorder() {}
+};
+} // namespace gawl::impl
@@ -0,0 +1,24 @@
+#include "macros/assert.hpp"
+#include "rect-shader.hpp"
+#include "shader-source.hpp"
+
+namespace gawl::impl {
+auto RectShader::set_instances(const size_t offset) -> void {
+    layout.set_pointers(offset);
+}
+
+auto RectShader::set_transform(const MetaScreen& screen) -> void {
+    transform.set(to_ndc_matrix(screen));
+    scale.set(screen.get_scale());
+}
+
+auto RectShader::init() -> bool {
+    ensure(Shader::init(rect_vertex_shader_source, rect_fragment_shader_source));
+    ensure(transform.init(shader_program, "transform"));
+    ensure(scale.init(shader_program, "scale"));
+    ensure(layout.init(shader_program));
+    const auto vabinder = bind_vao();
+    layout.enable(1);
+    return true;
+}
+} // namespace gawl::impl
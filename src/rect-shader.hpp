@@ -0,0 +1,34 @@
+#pragma once
+#include "shader.hpp"
+#include "vertex-layout.hpp"
+
+namespace gawl::impl {
+struct RectInstance {
+    GLfloat rect[4]; // {x1, y1, x2, y2} in screen coordinates
+    GLubyte fill[4];
+    GLubyte border[4];
+    GLfloat radius;
+    GLfloat border_width;
+};
+
+// rounded and bordered rects, one instance per rect
+class RectShader : public Shader {
+  private:
+    using Layout = VertexLayout<Attribute<"rect", &RectInstance::rect>,
+                                Attribute<"fill", &RectInstance::fill>,
+                                Attribute<"border", &RectInstance::border>,
+                                Attribute<"params", &RectInstance::radius, &RectInstance::border_width>>;
+
+    Layout       layout;
+    UniformMat3  transform;
+    UniformFloat scale;
+
+  public:
+    // the vertex array and the shader must be bound
+    // offset is the byte offset of the first instance in the bound array buffer
+    auto set_instances(size_t offset) -> void;
+    // the shader must be in use
+    auto set_transform(const MetaScreen& screen) -> void;
+    auto init() -> bool;
+};
+} // namespace gawl::impl
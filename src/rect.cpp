@@ -23,6 +23,10 @@ auto Rectangle::height() const -> double {
     return b.y - a.y;
 }
 
+auto Rectangle::intersects(const Rectangle& o) const -> bool {
+    return b.x >= o.a.x && a.x <= o.b.x && b.y >= o.a.y && a.y <= o.b.y;
+}
+
 auto Rectangle::operator+(const Point& o) const -> Rectangle {
     return {a + o, b + o};
 }
@@ -57,4 +61,24 @@ auto Rectangle::operator&=(const Rectangle& o) -> Rectangle& {
     b.y = std::min(b.y, o.b.y);
     return *this;
 }
+
+auto Rectangle::operator|=(const Rectangle& o) -> Rectangle& {
+    a.x = std::min(a.x, o.a.x);
+    a.y = std::min(a.y, o.a.y);
+    b.x = std::max(b.x, o.b.x);
+    b.y = std::max(b.y, o.b.y);
+    return *this;
+}
+
+auto bounding_box(const std::span<const Point> points) -> Rectangle {
+    if(points.empty()) {
+        return {};
+    }
+    auto r = Rectangle{points[0], points[0]};
+    for(const auto& p : points.subspan(1)) {
+        r.a = {std::min(r.a.x, p.x), std::min(r.a.y, p.y)};
+        r.b = {std::max(r.b.x, p.x), std::max(r.b.y, p.y)};
+    }
+    return r;
+}
 } // namespace gawl
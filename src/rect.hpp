@@ -1,5 +1,6 @@
 #pragma once
 #include <array>
+#include <span>
 
 #include "point.hpp"
 
@@ -12,13 +13,18 @@ struct Rectangle {
     auto to_points() const -> std::array<Point, 4>;
     auto width() const -> double;
     auto height() const -> double;
+    // touching edges count, so that zero sized rects of lines are kept
+    auto intersects(const Rectangle& o) const -> bool;
 
     auto operator+(const Point& p) const -> Rectangle;
     auto operator+=(const Point& p) -> Rectangle&;
     auto operator-(const Point& p) const -> Rectangle;
     auto operator-=(const Point& p) -> Rectangle&;
-    auto operator&=(const Rectangle& o) -> Rectangle&;
+    auto operator&=(const Rectangle& o) -> Rectangle&; // intersection
+    auto operator|=(const Rectangle& o) -> Rectangle&; // bounding box of both
     auto operator*(double n) const -> Rectangle;
     auto operator*=(double n) -> Rectangle;
 };
+
+auto bounding_box(std::span<const Point> points) -> Rectangle;
 } // namespace gawl
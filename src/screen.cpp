@@ -0,0 +1,68 @@
+#include <cmath>
+
+#include "batch.hpp"
+#include "macros/assert.hpp"
+#include "screen.hpp"
+
+namespace gawl {
+auto Screen::to_framebuffer(const Rectangle& rect) const -> Rectangle {
+    // screen coordinates are not moved by the viewport
+    return rect * get_scale();
+}
+
+auto Screen::apply_clip(std::optional<Rectangle> region, const size_t framebuffer_height) const -> void {
+    if(!clips.empty()) {
+        if(region) {
+            *region &= clips.back();
+        } else {
+            region = clips.back();
+        }
+    }
+    if(!region) {
+        glDisable(GL_SCISSOR_TEST);
+        return;
+    }
+    const auto x1 = std::lround(region->a.x);
+    const auto y1 = std::lround(region->a.y);
+    const auto x2 = std::max(x1, std::lround(region->b.x));
+    const auto y2 = std::max(y1, std::lround(region->b.y));
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(GLint(x1), GLint(long(framebuffer_height) - y2), GLsizei(x2 - x1), GLsizei(y2 - y1));
+}
+
+auto Screen::push_clip(const Rectangle& rect) -> void {
+    impl::flush_pending_batch();
+    auto r = to_framebuffer(rect);
+    if(!clips.empty()) {
+        r &= clips.back();
+    }
+    clips.push_back(r);
+}
+
+auto Screen::pop_clip() -> void {
+    ASSERT(!clips.empty(), "no clip to pop");
+    impl::flush_pending_batch();
+    clips.pop_back();
+}
+
+auto Screen::get_clip() const -> std::optional<Rectangle> {
+    if(clips.empty()) {
+        return std::nullopt;
+    }
+    return clips.back() * (1 / get_scale());
+}
+
+auto Screen::get_visible_rect() const -> std::optional<Rectangle> {
+    const auto& v = get_viewport();
+    auto        r = Rectangle{{double(v.base[0]), double(v.base[1])}, {double(v.base[0] + v.size[0]), double(v.base[1] + v.size[1])}};
+    if(!clips.empty()) {
+        r &= clips.back();
+    }
+    return r * (1 / get_scale());
+}
+
+auto Screen::is_visible(const Rectangle& rect) const -> bool {
+    const auto visible = get_visible_rect();
+    return !visible || rect.intersects(*visible);
+}
+} // namespace gawl
@@ -1,8 +1,15 @@
 #pragma once
+#include <optional>
+#include <vector>
+
 #include "binder.hpp"
 #include "viewport.hpp"
 
 namespace gawl {
+namespace impl {
+class Recorder;
+}
+
 class MetaScreen {
   public:
     virtual auto get_scale() const -> double             = 0;
@@ -11,9 +18,38 @@ class MetaScreen {
 };
 
 class Screen : public MetaScreen {
+  private:
+    std::vector<Rectangle> clips; // in framebuffer pixels, each intersected with the previous one
+
+    auto to_framebuffer(const Rectangle& rect) const -> Rectangle;
+
+  protected:
+    // set the scissor to the intersection of the region and the clip, both in framebuffer pixels
+    auto apply_clip(std::optional<Rectangle> region, size_t framebuffer_height) const -> void;
+
   public:
     virtual auto prepare() -> impl::FramebufferBinder        = 0;
     virtual auto set_viewport(const Rectangle& rect) -> void = 0;
     virtual auto unset_viewport() -> void                    = 0;
+    // queried once when the framebuffer is created
+    virtual auto has_stencil_buffer() const -> bool = 0;
+    // non-null if draws to this screen are recorded instead of executed
+    virtual auto get_recorder() -> impl::Recorder* {
+        return nullptr;
+    }
+
+    // restrict the following draws to the rect in screen coordinates, intersected with the current clip
+    // unlike set_viewport(), the coordinates are kept
+    // the scissor is updated by the next prepare(), so clear_screen() needs a draw or prepare() in between to be clipped
+    auto push_clip(const Rectangle& rect) -> void;
+    auto pop_clip() -> void;
+    // in screen coordinates, nullopt if not clipped
+    auto get_clip() const -> std::optional<Rectangle>;
+    // the intersection of the viewport and the clip in screen coordinates
+    // nullopt if draws are not bound to a visible area, e.g. they are recorded for later replays
+    virtual auto get_visible_rect() const -> std::optional<Rectangle>;
+    // false if the rect in screen coordinates is entirely outside of the visible rect
+    // draw functions use this to skip invisible primitives
+    auto is_visible(const Rectangle& rect) const -> bool;
 };
 } // namespace gawl
@@ -2,11 +2,12 @@
 namespace gawl::impl {
 constexpr auto graphic_vertex_shader_source      = R"glsl(
     #version 130
-    in vec2  position;
-    in vec2  texcoord;
-    out vec2 tex_coordinate;
+    in vec2      position;
+    in vec2      texcoord;
+    uniform mat3 transform; // to normalized device coordinates
+    out vec2     tex_coordinate;
     void main() {
-        gl_Position    = vec4(position, 0.0, 1.0);
+        gl_Position    = vec4((transform * vec3(position, 1.0)).xy, 0.0, 1.0);
         tex_coordinate = texcoord;
     }
 )glsl";
@@ -38,18 +39,366 @@ constexpr auto textrender_fragment_shader_source = R"glsl(
 
 constexpr auto polygon_vertex_shader_source      = R"glsl(
     #version 130
-    in vec2 position;
+    in vec2      position;
+    in vec4      vertex_color;
+    uniform mat3 transform; // to normalized device coordinates
+    out vec4     polygon_color;
     void main() {
-        gl_Position = vec4(position, 0.0, 1.0);
+        gl_Position   = vec4((transform * vec3(position, 1.0)).xy, 0.0, 1.0);
+        polygon_color = vertex_color;
     }
 )glsl";
 
 constexpr auto polygon_fragment_shader_source    = R"glsl(
     #version 130
-    out vec4     color;
-    uniform vec4 polygon_color;
+    in vec4  polygon_color;
+    out vec4 color;
     void main() {
         color = polygon_color;
     }
 )glsl";
+
+constexpr auto sprite_vertex_shader_source       = R"glsl(
+    #version 130
+    in vec2      position;
+    in vec2      texcoord;
+    in vec4      tint;
+    uniform mat3 transform; // to normalized device coordinates
+    out vec2     tex_coordinate;
+    out vec4     tint_color;
+    void main() {
+        gl_Position    = vec4((transform * vec3(position, 1.0)).xy, 0.0, 1.0);
+        tex_coordinate = texcoord;
+        tint_color     = tint;
+    }
+)glsl";
+
+constexpr auto sprite_fragment_shader_source     = R"glsl(
+    #version 130
+    in vec2           tex_coordinate;
+    in vec4           tint_color;
+    uniform sampler2D tex;
+    out vec4          color;
+    void main() {
+        color = texture(tex, tex_coordinate) * tint_color;
+    }
+)glsl";
+
+// sprite vertices with single channel glyph textures
+constexpr auto glyph_fragment_shader_source      = R"glsl(
+    #version 130
+    in vec2           tex_coordinate;
+    in vec4           tint_color;
+    uniform sampler2D tex;
+    out vec4          color;
+    void main() {
+        color = vec4(1.0, 1.0, 1.0, texture(tex, tex_coordinate).r) * tint_color;
+    }
+)glsl";
+
+// instanced, corners are generated from gl_VertexID
+// rect is {x1, y1, x2, y2} in screen coordinates, the distance function is evaluated in framebuffer pixels
+constexpr auto rect_vertex_shader_source         = R"glsl(
+    #version 130
+    in vec4       rect;
+    in vec4       fill;
+    in vec4       border;
+    in vec2       params;    // radius, border width
+    uniform mat3  transform; // to normalized device coordinates
+    uniform float scale;     // screen coordinates to framebuffer pixels
+    out vec2      local;
+    flat out vec2 half_size;
+    flat out vec4 fill_color;
+    flat out vec4 border_color;
+    flat out vec2 shape;
+    void main() {
+        vec4 r       = rect * scale;
+        vec2 corner  = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+        vec2 pos     = mix(r.xy - 1.0, r.zw + 1.0, corner); // margin for the antialiased edge
+        gl_Position  = vec4((transform * vec3(pos / scale, 1.0)).xy, 0.0, 1.0);
+        half_size    = (r.zw - r.xy) / 2.0;
+        local        = pos - (r.xy + half_size);
+        fill_color   = fill;
+        border_color = border;
+        shape        = vec2(min(params.x * scale, min(half_size.x, half_size.y)), params.y * scale);
+    }
+)glsl";
+
+constexpr auto rect_fragment_shader_source       = R"glsl(
+    #version 130
+    in vec2      local;
+    flat in vec2 half_size;
+    flat in vec4 fill_color;
+    flat in vec4 border_color;
+    flat in vec2 shape;
+    out vec4     color;
+    void main() {
+        vec2  q        = abs(local) - half_size + shape.x;
+        float dist     = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - shape.x;
+        float coverage = clamp(0.5 - dist, 0.0, 1.0);
+        vec4  inside   = fill_color;
+        if(shape.y > 0.0) {
+            inside = mix(border_color, fill_color, clamp(0.5 - (dist + shape.y), 0.0, 1.0));
+        }
+        color = vec4(inside.rgb, inside.a * coverage);
+    }
+)glsl";
+
+// instanced, circles are capsules with zero length
+// segment is {a.x, a.y, b.x, b.y} in screen coordinates, angles are in turns
+// the distance function is evaluated in framebuffer pixels
+constexpr auto shape_vertex_shader_source        = R"glsl(
+    #version 130
+    in vec4       segment;
+    in vec4       params;    // radius, inner radius, start angle, sweep
+    in vec4       fill;
+    uniform mat3  transform; // to normalized device coordinates
+    uniform float scale;     // screen coordinates to framebuffer pixels
+    out vec2      local;
+    flat out vec2 axis;
+    flat out vec4 shape;
+    flat out vec4 shape_color;
+    void main() {
+        vec4 s      = segment * scale;
+        vec2 radii  = params.xy * scale;
+        vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+        vec2 lo     = min(s.xy, s.zw) - radii.x - 1.0;
+        vec2 hi     = max(s.xy, s.zw) + radii.x + 1.0;
+        vec2 pos    = mix(lo, hi, corner);
+        gl_Position = vec4((transform * vec3(pos / scale, 1.0)).xy, 0.0, 1.0);
+        local       = pos - s.xy;
+        axis        = s.zw - s.xy;
+        shape       = vec4(radii, params.zw);
+        shape_color = fill;
+    }
+)glsl";
+
+constexpr auto shape_fragment_shader_source      = R"glsl(
+    #version 130
+    in vec2      local;
+    flat in vec2 axis;
+    flat in vec4 shape;
+    flat in vec4 shape_color;
+    out vec4     color;
+
+    const float pi = 3.14159265358979;
+
+    float ray_distance(vec2 p, float angle) {
+        vec2 dir = vec2(cos(angle), sin(angle));
+        return length(p - dir * max(dot(p, dir), 0.0));
+    }
+
+    void main() {
+        float len2   = dot(axis, axis);
+        float t      = len2 > 0.0 ? clamp(dot(local, axis) / len2, 0.0, 1.0) : 0.0;
+        float center = length(local - axis * t);
+        float dist   = center - shape.x;
+        if(shape.y > 0.0) {
+            dist = max(dist, shape.y - center);
+        }
+        if(shape.w < 1.0) {
+            float start  = shape.z * 2.0 * pi;
+            float sweep  = shape.w * 2.0 * pi;
+            float edge   = min(ray_distance(local, start), ray_distance(local, start + sweep));
+            bool  inside = mod(atan(local.y, local.x) - start, 2.0 * pi) <= sweep;
+            dist         = max(dist, inside ? -edge : edge);
+        }
+        color = vec4(shape_color.rgb, shape_color.a * clamp(0.5 - dist, 0.0, 1.0));
+    }
+)glsl";
+
+// instanced, one instance per point, each reads the point and its 3 successors as prev, a, b and next
+// a instance draws the segment a-b, a join at b and a cap at a or b
+constexpr auto polyline_vertex_shader_source     = R"glsl(
+    #version 130
+    in vec2        prev;
+    in vec4        prev_style;
+    in vec2        point_a;
+    in float       half_width;
+    in vec4        color_a;
+    in vec4        style_a; // flags, join, cap
+    in vec2        point_b;
+    in vec2        next;
+    in vec4        next_style;
+    uniform mat3   transform; // to normalized device coordinates
+    uniform float  scale;     // screen coordinates to framebuffer pixels
+    out float      edge;
+    out vec2       local;    // from the center of round parts
+    out vec2       cap_dist; // distance past the butt or square ends at a and b
+    out vec2       from_a;   // from point a
+    flat out float round_part;
+    flat out vec4  round_keep; // two half planes of local kept by round parts
+    flat out vec3  prev_body;  // direction and length of the previous segment if this body overlaps it
+    flat out float line_half_width;
+    flat out vec4  line_color;
+
+    const float miter_limit = 4.0;
+
+    vec2 normal_of(vec2 d) {
+        return vec2(-d.y, d.x);
+    }
+
+    vec2 direction(vec2 from, vec2 to) {
+        vec2  d = to - from;
+        float l = length(d);
+        return l > 0.0 ? d / l : vec2(1.0, 0.0);
+    }
+
+    // returns the length scale of the miter, miter_limit + 1 if it is too long
+    float miter_of(vec2 n, vec2 other, out vec2 miter) {
+        vec2  sum = n + other;
+        float len = length(sum);
+        miter     = len > 0.001 ? sum / len : n;
+        return len > 0.001 ? 1.0 / max(dot(miter, n), 0.0001) : miter_limit + 1.0;
+    }
+
+    void main() {
+        // everything below is in framebuffer pixels
+        vec2  p_prev    = prev * scale;
+        vec2  p_a       = point_a * scale;
+        vec2  p_b       = point_b * scale;
+        vec2  p_next    = next * scale;
+        float hw        = half_width * scale;
+        float ahw       = hw + 1.0; // margin for the antialiased edge
+        int   flags     = int(style_a.x);
+        int   join      = int(style_a.y);
+        int   cap       = int(style_a.z);
+        bool  first     = (int(prev_style.x) & 1) != 0;
+        bool  last      = (int(next_style.x) & 1) != 0;
+        vec2  dir       = direction(p_a, p_b);
+        vec2  n         = normal_of(dir);
+        vec2  dir_prev  = direction(p_prev, p_a);
+        vec2  dir_next  = direction(p_b, p_next);
+        int   part      = gl_VertexID / 6;
+        int   v         = gl_VertexID % 6;
+        int   corner    = v < 3 ? v : v == 3 ? 2 : v == 4 ? 1 : 3;
+        vec2  c         = vec2(corner & 1, corner >> 1);
+        vec2  pos       = p_a;
+        edge            = 0.0;
+        local           = vec2(0.0);
+        cap_dist        = vec2(-ahw);
+        round_part      = 0.0;
+        round_keep      = vec4(0.0);
+        prev_body       = vec3(0.0);
+        line_half_width = hw;
+        line_color      = color_a;
+
+        if((flags & 2) == 0) {
+            // not a segment start, e.g. padding between lines
+            gl_Position = vec4(-2.0, -2.0, 0.0, 1.0);
+            return;
+        }
+        if(part == 1) {
+            // segment body
+            bool  at_b   = c.x > 0.5;
+            float side   = c.y * 2.0 - 1.0;
+            float ext    = cap == 1 ? hw : 0.0; // square caps extend by the half width
+            vec2  offset = n * ahw * side;
+            if(at_b ? last : first) {
+                if(cap != 2) {
+                    offset += dir * (ext + 1.0) * (at_b ? 1.0 : -1.0);
+                }
+            } else if(join == 0) {
+                vec2  miter;
+                float stretch = miter_of(n, normal_of(at_b ? dir_next : dir_prev), miter);
+                if(stretch <= miter_limit) {
+                    offset = miter * ahw * side * stretch;
+                }
+            }
+            pos  = (at_b ? p_b : p_a) + offset;
+            edge = ahw * side;
+
+            // fade out the butt and square ends
+            float along = dot(pos - p_a, dir);
+            cap_dist.x  = first && cap != 2 ? -along - ext : -ahw;
+            cap_dist.y  = last && cap != 2 ? along - length(p_b - p_a) - ext : -ahw;
+
+            // bevel and round joins leave both bodies overlapping on the inner side of the turn
+            vec2 miter;
+            bool mitered = join == 0 && miter_of(n, normal_of(dir_prev), miter) <= miter_limit;
+            if(!first && !mitered) {
+                prev_body = vec3(dir_prev, length(p_a - p_prev));
+            }
+        } else {
+            // round caps at a or b, joins at b
+            bool at_b   = part == 2;
+            vec2 center = at_b ? p_b : p_a;
+            bool capped = at_b ? last : first;
+            pos         = center;
+            if(capped ? cap == 2 : (at_b && join == 2)) {
+                pos        = center + (c * 2.0 - 1.0) * ahw;
+                local      = pos - center;
+                round_part = 1.0;
+                // only the part no body covers
+                round_keep = capped ? (at_b ? vec4(dir, dir) : vec4(-dir, -dir)) : vec4(dir, -dir_next);
+            } else if(!capped && at_b && join != 2) {
+                vec2  miter;
+                vec2  n_next  = normal_of(dir_next);
+                float stretch = miter_of(n, n_next, miter);
+                if((join == 1 || stretch > miter_limit) && v < 3) {
+                    // single triangle filling the outer side of the turn
+                    float side = dot(dir_next, n) > 0.0 ? -1.0 : 1.0;
+                    if(v == 1) {
+                        pos = center + n * ahw * side;
+                    } else if(v == 2) {
+                        pos = center + n_next * ahw * side;
+                    }
+                    edge = v == 0 ? 0.0 : ahw;
+                }
+            }
+        }
+        from_a      = pos - p_a;
+        gl_Position = vec4((transform * vec3(pos / scale, 1.0)).xy, 0.0, 1.0);
+    }
+)glsl";
+
+constexpr auto polyline_fragment_shader_source   = R"glsl(
+    #version 130
+    in float      edge;
+    in vec2       local;
+    in vec2       cap_dist;
+    in vec2       from_a;
+    flat in float round_part;
+    flat in vec4  round_keep;
+    flat in vec3  prev_body;
+    flat in float line_half_width;
+    flat in vec4  line_color;
+    out vec4      color;
+    void main() {
+        // draw every pixel once so that translucent lines do not get darker at joins
+        if(round_part > 0.5 && (dot(local, round_keep.xy) < 0.0 || dot(local, round_keep.zw) < 0.0)) {
+            discard;
+        }
+        float back = -dot(from_a, prev_body.xy);
+        if(back > 0.0 && back < prev_body.z && abs(dot(from_a, vec2(-prev_body.y, prev_body.x))) < line_half_width) {
+            discard;
+        }
+        float dist     = round_part > 0.5 ? length(local) : abs(edge);
+        float coverage = clamp(line_half_width + 0.5 - dist, 0.0, 1.0);
+        coverage *= clamp(0.5 - cap_dist.x, 0.0, 1.0) * clamp(0.5 - cap_dist.y, 0.0, 1.0);
+        color = vec4(line_color.rgb, line_color.a * coverage);
+    }
+)glsl";
+
+constexpr auto mesh_vertex_shader_source         = R"glsl(
+    #version 130
+    in vec2      position;
+    in vec4      vertex_color;
+    uniform mat3 transform; // to normalized device coordinates
+    out vec4     mesh_color;
+    void main() {
+        gl_Position = vec4((transform * vec3(position, 1.0)).xy, 0.0, 1.0);
+        mesh_color  = vertex_color;
+    }
+)glsl";
+
+constexpr auto mesh_fragment_shader_source       = R"glsl(
+    #version 130
+    in vec4      mesh_color;
+    uniform vec4 tint;
+    out vec4     color;
+    void main() {
+        color = mesh_color * tint;
+    }
+)glsl";
 } // namespace gawl::internal
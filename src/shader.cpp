@@ -23,6 +23,68 @@ auto compile_shader(const uint32_t type, const char* const source) -> std::optio
 } // namespace
 
 namespace gawl::impl {
+auto UniformVec4::init(const GLuint program, const char* const name) -> bool {
+    location = glGetUniformLocation(program, name);
+    ensure(location != -1, "no such uniform {}", name);
+    valid = false;
+    return true;
+}
+
+auto UniformVec4::set(const Color& color) -> void {
+    const auto v = std::array{GLfloat(color[0]), GLfloat(color[1]), GLfloat(color[2]), GLfloat(color[3])};
+    if(valid && v == value) {
+        return;
+    }
+    glUniform4fv(location, 1, v.data());
+    value = v;
+    valid = true;
+}
+
+auto UniformFloat::init(const GLuint program, const char* const name) -> bool {
+    location = glGetUniformLocation(program, name);
+    ensure(location != -1, "no such uniform {}", name);
+    valid = false;
+    return true;
+}
+
+auto UniformFloat::set(const double value) -> void {
+    const auto v = GLfloat(value);
+    if(valid && v == this->value) {
+        return;
+    }
+    glUniform1f(location, v);
+    this->value = v;
+    valid       = true;
+}
+
+auto UniformMat3::init(const GLuint program, const char* const name) -> bool {
+    location = glGetUniformLocation(program, name);
+    ensure(location != -1, "no such uniform {}", name);
+    valid = false;
+    return true;
+}
+
+auto UniformMat3::set(const Mat3& matrix) -> void {
+    if(valid && matrix == value) {
+        return;
+    }
+    glUniformMatrix3fv(location, 1, GL_FALSE, matrix.data());
+    value = matrix;
+    valid = true;
+}
+
+auto to_ndc_matrix(const MetaScreen& screen, const Transform& transform) -> Mat3 {
+    const auto& v  = screen.get_viewport();
+    const auto  s  = screen.get_scale();
+    const auto  sx = 2.0 * s / v.size[0];
+    const auto  sy = -2.0 * s / v.size[1];
+    const auto& m  = transform.m;
+    return {
+        GLfloat(sx * m[0]), GLfloat(sy * m[3]), 0,
+        GLfloat(sx * m[1]), GLfloat(sy * m[4]), 0,
+        GLfloat(sx * m[2] - 2.0 * v.base[0] / v.size[0] - 1), GLfloat(sy * m[5] + 2.0 * v.base[1] / v.size[1] + 1), 1};
+}
+
 auto Shader::init(const char* vertex_shader_source, const char* fragment_shader_source) -> bool {
     glGenVertexArrays(1, &vao);
     glGenBuffers(1, &vbo);
@@ -42,6 +104,10 @@ auto Shader::init(const char* vertex_shader_source, const char* fragment_shader_
 }
 
 Shader::~Shader() {
+    bind_cache.forget(BindCache::ElementBuffer, ebo);
+    bind_cache.forget(BindCache::ArrayBuffer, vbo);
+    bind_cache.forget(BindCache::VArray, vao);
+    bind_cache.forget(BindCache::Shader, shader_program);
     glDeleteBuffers(1, &ebo);
     glDeleteBuffers(1, &vbo);
     glDeleteVertexArrays(1, &vao);
@@ -1,7 +1,53 @@
 #pragma once
 #include "binder.hpp"
+#include "color.hpp"
+#include "screen.hpp"
+#include "transform.hpp"
 
 namespace gawl::impl {
+// column major 3x3 matrix
+using Mat3 = std::array<GLfloat, 9>;
+
+// maps screen coordinates under the transform to normalized device coordinates of the screen's viewport
+auto to_ndc_matrix(const MetaScreen& screen, const Transform& transform = {}) -> Mat3;
+
+// location is resolved once, and uploads of the current value are skipped
+class UniformVec4 {
+  private:
+    GLint                  location = -1;
+    std::array<GLfloat, 4> value;
+    bool                   valid = false;
+
+  public:
+    auto init(GLuint program, const char* name) -> bool;
+    // the program must be in use
+    auto set(const Color& color) -> void;
+};
+
+class UniformFloat {
+  private:
+    GLint   location = -1;
+    GLfloat value;
+    bool    valid = false;
+
+  public:
+    auto init(GLuint program, const char* name) -> bool;
+    // the program must be in use
+    auto set(double value) -> void;
+};
+
+class UniformMat3 {
+  private:
+    GLint location = -1;
+    Mat3  value;
+    bool  valid = false;
+
+  public:
+    auto init(GLuint program, const char* name) -> bool;
+    // the program must be in use
+    auto set(const Mat3& matrix) -> void;
+};
+
 class Shader {
   protected:
     GLuint vao;
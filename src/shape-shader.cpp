@@ -0,0 +1,24 @@
+#include "macros/assert.hpp"
+#include "shader-source.hpp"
+#include "shape-shader.hpp"
+
+namespace gawl::impl {
+auto ShapeShader::set_instances(const size_t offset) -> void {
+    layout.set_pointers(offset);
+}
+
+auto ShapeShader::set_transform(const MetaScreen& screen) -> void {
+    transform.set(to_ndc_matrix(screen));
+    scale.set(screen.get_scale());
+}
+
+auto ShapeShader::init() -> bool {
+    ensure(Shader::init(shape_vertex_shader_source, shape_fragment_shader_source));
+    ensure(transform.init(shader_program, "transform"));
+    ensure(scale.init(shader_program, "scale"));
+    ensure(layout.init(shader_program));
+    const auto vabinder = bind_vao();
+    layout.enable(1);
+    return true;
+}
+} // namespace gawl::impl
@@ -0,0 +1,34 @@
+#pragma once
+#include "shader.hpp"
+#include "vertex-layout.hpp"
+
+namespace gawl::impl {
+struct ShapeInstance {
+    GLfloat segment[4]; // {a.x, a.y, b.x, b.y} in screen coordinates
+    GLfloat radius;
+    GLfloat inner_radius; // 0 if filled
+    GLfloat start;        // in turns
+    GLfloat sweep;        // in turns, >= 1 if not clipped
+    GLubyte color[4];
+};
+
+// circles, rings, arcs, pies and capsules evaluated as distance functions, one instance per shape
+class ShapeShader : public Shader {
+  private:
+    using Layout = VertexLayout<Attribute<"segment", &ShapeInstance::segment>,
+                                Attribute<"params", &ShapeInstance::radius, &ShapeInstance::inner_radius, &ShapeInstance::start, &ShapeInstance::sweep>,
+                                Attribute<"fill", &ShapeInstance::color>>;
+
+    Layout       layout;
+    UniformMat3  transform;
+    UniformFloat scale;
+
+  public:
+    // the vertex array and the shader must be bound
+    // offset is the byte offset of the first instance in the bound array buffer
+    auto set_instances(size_t offset) -> void;
+    // the shader must be in use
+    auto set_transform(const MetaScreen& screen) -> void;
+    auto init() -> bool;
+};
+} // namespace gawl::impl
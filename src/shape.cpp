@@ -0,0 +1,92 @@
+#include <vector>
+
+#include "batch.hpp"
+#include "global.hpp"
+#include "recorder.hpp"
+#include "shape.hpp"
+
+namespace gawl {
+namespace {
+class ShapeBatch : public impl::Batcher {
+  private:
+    Screen*                          screen = nullptr;
+    std::vector<impl::ShapeInstance> instances;
+
+  public:
+    auto append(Screen& screen, const Point& a, const Point& b, const double radius, const double width, std::pair<double, double> angle, const Color& color) -> void {
+        if(!screen.is_visible(bounding_box(std::array{a, b}).expand(radius, radius))) {
+            return;
+        }
+        if(this->screen != &screen) {
+            flush();
+            this->screen = &screen;
+        }
+        impl::set_pending_batch(this);
+
+        if(angle.second < 0) {
+            angle = {angle.first + angle.second, -angle.second};
+        }
+        const auto rgba = impl::to_rgba8(color);
+        instances.push_back({
+            .segment      = {GLfloat(a.x), GLfloat(a.y), GLfloat(b.x), GLfloat(b.y)},
+            .radius       = GLfloat(radius),
+            .inner_radius = GLfloat(width > 0 ? radius - width : 0),
+            .start        = GLfloat(angle.first),
+            .sweep        = GLfloat(angle.second),
+            .color        = {rgba[0], rgba[1], rgba[2], rgba[3]},
+        });
+    }
+
+    auto flush() -> void override {
+        impl::forget_pending_batch(this);
+        if(instances.empty()) {
+            return;
+        }
+        if(const auto recorder = screen->get_recorder()) {
+            recorder->record(impl::RecordKind::Shapes, instances.data(), instances.size(), sizeof(impl::ShapeInstance));
+            instances.clear();
+            return;
+        }
+        auto&      gl       = impl::global->shape_shader;
+        const auto offset   = impl::global->vertex_ring.write(instances.data(), instances.size() * sizeof(impl::ShapeInstance), sizeof(impl::ShapeInstance));
+        const auto vabinder = gl.bind_vao();
+        const auto vbbinder = impl::global->vertex_ring.bind();
+        const auto shbinder = gl.use_shader();
+        const auto fbbinder = screen->prepare();
+        gl.set_instances(offset);
+        gl.set_transform(*screen);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, GLsizei(instances.size()));
+        instances.clear();
+    }
+
+    ~ShapeBatch() {
+        impl::forget_pending_batch(this);
+    }
+};
+
+auto get_shape_batch() -> ShapeBatch& {
+    static thread_local auto batch = ShapeBatch();
+    return batch;
+}
+} // namespace
+
+auto draw_circle(Screen& screen, const Point& center, const double radius, const Color& color) -> void {
+    get_shape_batch().append(screen, center, center, radius, 0, {0, 1}, color);
+}
+
+auto draw_ring(Screen& screen, const Point& center, const double radius, const double width, const Color& color) -> void {
+    get_shape_batch().append(screen, center, center, radius, width, {0, 1}, color);
+}
+
+auto draw_pie(Screen& screen, const Point& center, const double radius, const std::pair<double, double>& angle, const Color& color) -> void {
+    get_shape_batch().append(screen, center, center, radius, 0, angle, color);
+}
+
+auto draw_arc(Screen& screen, const Point& center, const double radius, const double width, const std::pair<double, double>& angle, const Color& color) -> void {
+    get_shape_batch().append(screen, center, center, radius, width, angle, color);
+}
+
+auto draw_capsule(Screen& screen, const Point& a, const Point& b, const double radius, const Color& color) -> void {
+    get_shape_batch().append(screen, a, b, radius, 0, {0, 1}, color);
+}
+} // namespace gawl
@@ -0,0 +1,14 @@
+#pragma once
+#include "color.hpp"
+#include "screen.hpp"
+
+namespace gawl {
+// antialiased shapes drawn as a single quad each, regardless of the size
+// angles are {start, sweep} in turns, same as triangulate_circle_angle()
+// widths are measured inward from the radius
+auto draw_circle(Screen& screen, const Point& center, double radius, const Color& color) -> void;
+auto draw_ring(Screen& screen, const Point& center, double radius, double width, const Color& color) -> void;
+auto draw_pie(Screen& screen, const Point& center, double radius, const std::pair<double, double>& angle, const Color& color) -> void;
+auto draw_arc(Screen& screen, const Point& center, double radius, double width, const std::pair<double, double>& angle, const Color& color) -> void;
+auto draw_capsule(Screen& screen, const Point& a, const Point& b, double radius, const Color& color) -> void;
+} // namespace gawl
@@ -0,0 +1,93 @@
+#include "sprite-batch.hpp"
+#include "global.hpp"
+#include "recorder.hpp"
+
+namespace gawl {
+auto SpriteBatch::push(Screen& screen, const impl::GraphicBase& graphic, const std::array<Point, 4>& points, const impl::TexCoords& uv, const Color& tint) -> void {
+    if(!screen.is_visible(bounding_box(points))) {
+        return;
+    }
+    if(this->screen != &screen) {
+        flush();
+        this->screen = &screen;
+    }
+    impl::set_pending_batch(this);
+    const auto texture = graphic.get_texture();
+    if(runs.empty() || runs.back().texture != texture) {
+        runs.push_back({texture, 0});
+    }
+    runs.back().quads += 1;
+
+    vertices.resize(vertices.size() + 4);
+    impl::fill_sprite_quad(&vertices[vertices.size() - 4], points, uv, graphic.invert_top_bottom, tint);
+}
+
+auto SpriteBatch::draw_rect(Screen& screen, const impl::GraphicBase& graphic, const Rectangle& rect, const Color& tint) -> void {
+    draw_rect_uv(screen, graphic, rect, impl::full_texcoords, tint);
+}
+
+auto SpriteBatch::draw_rect_uv(Screen& screen, const impl::GraphicBase& graphic, const Rectangle& rect, const impl::TexCoords& uv, const Color& tint) -> void {
+    push(screen, graphic, {rect.a, {rect.b.x, rect.a.y}, rect.b, {rect.a.x, rect.b.y}}, uv, tint);
+}
+
+auto SpriteBatch::draw_transformed(Screen& screen, const impl::GraphicBase& graphic, const std::array<Point, 4>& vertices, const Color& tint) -> void {
+    draw_transformed_uv(screen, graphic, vertices, impl::full_texcoords, tint);
+}
+
+auto SpriteBatch::draw_transformed_uv(Screen& screen, const impl::GraphicBase& graphic, const std::array<Point, 4>& vertices, const impl::TexCoords& uv, const Color& tint) -> void {
+    push(screen, graphic, vertices, uv, tint);
+}
+
+auto SpriteBatch::draw_rect(Screen& screen, const SubGraphic& graphic, const Rectangle& rect, const Color& tint) -> void {
+    draw_rect_uv(screen, graphic.get_parent(), rect, graphic.get_texcoords(), tint);
+}
+
+auto SpriteBatch::draw_transformed(Screen& screen, const SubGraphic& graphic, const std::array<Point, 4>& vertices, const Color& tint) -> void {
+    draw_transformed_uv(screen, graphic.get_parent(), vertices, graphic.get_texcoords(), tint);
+}
+
+auto SpriteBatch::flush() -> void {
+    impl::forget_pending_batch(this);
+    if(vertices.empty()) {
+        return;
+    }
+    if(const auto recorder = screen->get_recorder()) {
+        auto base = 0uz;
+        for(const auto& run : runs) {
+            recorder->record(impl::RecordKind::Sprites, &vertices[base], run.quads * 4, sizeof(impl::SpriteVertex), run.texture);
+            base += run.quads * 4;
+        }
+        vertices.clear();
+        runs.clear();
+        return;
+    }
+    auto&      gl       = impl::global->sprite_shader;
+    const auto offset   = impl::global->vertex_ring.write(vertices.data(), vertices.size() * sizeof(impl::SpriteVertex), sizeof(impl::SpriteVertex));
+    const auto vabinder = gl.bind_vao();
+    const auto vbbinder = impl::global->vertex_ring.bind();
+    const auto shbinder = gl.use_shader();
+    const auto fbbinder = screen->prepare();
+    gl.set_vertices(offset);
+    gl.set_transform(*screen);
+
+    auto base = 0uz;
+    for(const auto& run : runs) {
+        const auto txbinder = impl::TextureBinder(run.texture);
+        for(auto done = 0uz; done < run.quads; done += impl::SpriteShader::max_quads) {
+            const auto quads = std::min(run.quads - done, impl::SpriteShader::max_quads);
+            glDrawElementsBaseVertex(GL_TRIANGLES, GLsizei(quads * 6), GL_UNSIGNED_INT, 0, GLint(base + done * 4));
+        }
+        base += run.quads * 4;
+    }
+    vertices.clear();
+    runs.clear();
+}
+
+auto SpriteBatch::get_pending() const -> size_t {
+    return vertices.size() / 4;
+}
+
+SpriteBatch::~SpriteBatch() {
+    impl::forget_pending_batch(this);
+}
+} // namespace gawl
@@ -0,0 +1,39 @@
+#pragma once
+#include <vector>
+
+#include "batch.hpp"
+#include "color.hpp"
+#include "sprite-shader.hpp"
+#include "sub-graphic.hpp"
+
+namespace gawl {
+// accumulates textured quads and draws them with one draw call per texture change
+// consecutive sprites sharing a texture are merged, so draw atlas pages or sub graphics together
+// pending sprites are flushed automatically before other draws, graphics must outlive the flush
+class SpriteBatch : public impl::Batcher {
+  private:
+    struct Run {
+        GLuint texture;
+        size_t quads;
+    };
+
+    Screen*                         screen = nullptr;
+    std::vector<impl::SpriteVertex> vertices;
+    std::vector<Run>                runs;
+
+    auto push(Screen& screen, const impl::GraphicBase& graphic, const std::array<Point, 4>& points, const impl::TexCoords& uv, const Color& tint) -> void;
+
+  public:
+    auto draw_rect(Screen& screen, const impl::GraphicBase& graphic, const Rectangle& rect, const Color& tint = {1, 1, 1, 1}) -> void;
+    auto draw_rect_uv(Screen& screen, const impl::GraphicBase& graphic, const Rectangle& rect, const impl::TexCoords& uv, const Color& tint = {1, 1, 1, 1}) -> void;
+    auto draw_transformed(Screen& screen, const impl::GraphicBase& graphic, const std::array<Point, 4>& vertices, const Color& tint = {1, 1, 1, 1}) -> void;
+    auto draw_transformed_uv(Screen& screen, const impl::GraphicBase& graphic, const std::array<Point, 4>& vertices, const impl::TexCoords& uv, const Color& tint = {1, 1, 1, 1}) -> void;
+    auto draw_rect(Screen& screen, const SubGraphic& graphic, const Rectangle& rect, const Color& tint = {1, 1, 1, 1}) -> void;
+    auto draw_transformed(Screen& screen, const SubGraphic& graphic, const std::array<Point, 4>& vertices, const Color& tint = {1, 1, 1, 1}) -> void;
+    // issue the pending draws
+    auto flush() -> void override;
+    auto get_pending() const -> size_t;
+
+    ~SpriteBatch();
+};
+} // namespace gawl
@@ -0,0 +1,55 @@
+#include <algorithm>
+#include <vector>
+
+#include "macros/assert.hpp"
+#include "shader-source.hpp"
+#include "sprite-shader.hpp"
+
+namespace gawl::impl {
+auto fill_sprite_quad(SpriteVertex* const quad, const std::array<Point, 4>& points, const TexCoords& uv, const bool invert, const Color& tint) -> void {
+    // inverted textures store the bottom row first
+    const auto unorm     = [](const GLfloat f) { return GLushort(f * 65535 + 0.5f); };
+    const auto u0        = unorm(uv[0]);
+    const auto u1        = unorm(uv[2]);
+    const auto v0        = unorm(invert ? uv[3] : uv[1]);
+    const auto v1        = unorm(invert ? uv[1] : uv[3]);
+    const auto color     = to_rgba8(tint);
+    const auto texcoords = std::array<std::array<GLushort, 2>, 4>{{{u0, v0}, {u1, v0}, {u1, v1}, {u0, v1}}};
+    pack_points(points, quad, sizeof(SpriteVertex));
+    for(auto i = 0uz; i < 4; i += 1) {
+        quad[i].u = texcoords[i][0];
+        quad[i].v = texcoords[i][1];
+        std::ranges::copy(color, quad[i].color);
+    }
+}
+
+auto SpriteShader::set_transform(const MetaScreen& screen, const Transform& transform) -> void {
+    this->transform.set(to_ndc_matrix(screen, transform));
+}
+
+auto SpriteShader::set_vertices(const size_t offset) -> void {
+    layout.set_pointers(offset);
+}
+
+auto SpriteShader::init(const char* const fragment_shader_source) -> bool {
+    ensure(Shader::init(sprite_vertex_shader_source, fragment_shader_source));
+    ensure(transform.init(shader_program, "transform"));
+    ensure(layout.init(shader_program));
+    const auto vabinder = bind_vao();
+    const auto ebbinder = bind_ebo();
+    layout.enable();
+
+    auto elements = std::vector<GLuint>(max_quads * 6);
+    for(auto i = 0uz; i < max_quads; i += 1) {
+        const auto base     = GLuint(i * 4);
+        elements[i * 6 + 0] = base + 0;
+        elements[i * 6 + 1] = base + 1;
+        elements[i * 6 + 2] = base + 2;
+        elements[i * 6 + 3] = base + 2;
+        elements[i * 6 + 4] = base + 3;
+        elements[i * 6 + 5] = base + 0;
+    }
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, elements.size() * sizeof(GLuint), elements.data(), GL_STATIC_DRAW);
+    return true;
+}
+} // namespace gawl::impl
@@ -0,0 +1,40 @@
+#pragma once
+#include "graphic-shader.hpp"
+#include "shader-source.hpp"
+#include "shader.hpp"
+#include "vertex-layout.hpp"
+
+namespace gawl::impl {
+struct SpriteVertex {
+    GLfloat  x;
+    GLfloat  y;
+    GLushort u; // normalized
+    GLushort v;
+    GLubyte  color[4];
+};
+
+// writes a quad of 4 vertices, top-left first and clockwise
+auto fill_sprite_quad(SpriteVertex* quad, const std::array<Point, 4>& points, const TexCoords& uv, bool invert, const Color& tint) -> void;
+
+// textured quads, also used for glyphs with glyph_fragment_shader_source
+class SpriteShader : public Shader {
+  private:
+    using Layout = VertexLayout<Attribute<"position", &SpriteVertex::x, &SpriteVertex::y>,
+                                Attribute<"texcoord", &SpriteVertex::u, &SpriteVertex::v>,
+                                Attribute<"tint", &SpriteVertex::color>>;
+
+    Layout      layout;
+    UniformMat3 transform;
+
+  public:
+    // quads drawn by one glDrawElements, limited by the element buffer
+    static constexpr auto max_quads = 16384uz;
+
+    // the shader must be in use
+    auto set_transform(const MetaScreen& screen, const Transform& transform = {}) -> void;
+    // the vertex array must be bound
+    // offset is the byte offset of the first vertex in the bound array buffer
+    auto set_vertices(size_t offset) -> void;
+    auto init(const char* fragment_shader_source = sprite_fragment_shader_source) -> bool;
+};
+} // namespace gawl::impl
@@ -0,0 +1,46 @@
+#include "sub-graphic.hpp"
+#include "misc.hpp"
+
+namespace gawl {
+auto SubGraphic::get_parent() const -> const impl::GraphicBase& {
+    return *parent;
+}
+
+auto SubGraphic::get_texcoords() const -> const impl::TexCoords& {
+    return uv;
+}
+
+auto SubGraphic::get_width(const MetaScreen& screen) const -> int {
+    return width / screen.get_scale();
+}
+
+auto SubGraphic::get_height(const MetaScreen& screen) const -> int {
+    return height / screen.get_scale();
+}
+
+auto SubGraphic::draw(Screen& screen, const Point& point) const -> void {
+    draw_rect(screen, {{point.x, point.y}, {point.x + width, point.y + height}});
+}
+
+auto SubGraphic::draw_rect(Screen& screen, const Rectangle& rect) const -> void {
+    parent->draw_rect_uv(screen, rect, uv);
+}
+
+auto SubGraphic::draw_fit_rect(Screen& screen, const Rectangle& rect) const -> void {
+    draw_rect(screen, calc_fit_rect(rect, width, height));
+}
+
+auto SubGraphic::draw_transformed(Screen& screen, const std::array<Point, 4>& vertices) const -> void {
+    parent->draw_transformed_uv(screen, vertices, uv);
+}
+
+SubGraphic::operator bool() const {
+    return parent != nullptr;
+}
+
+SubGraphic::SubGraphic(std::shared_ptr<const impl::GraphicBase> parent, const std::array<int, 4>& rect)
+    : parent(std::move(parent)),
+      uv(this->parent->get_texcoords(rect)),
+      width(rect[2]),
+      height(rect[3]) {}
+} // namespace gawl
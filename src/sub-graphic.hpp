@@ -0,0 +1,31 @@
+#pragma once
+#include <memory>
+
+#include "graphic-base.hpp"
+
+namespace gawl {
+// view to a part of other texture, shares pixels with its parent
+class SubGraphic {
+  private:
+    std::shared_ptr<const impl::GraphicBase> parent;
+    impl::TexCoords                          uv;
+    int                                      width;
+    int                                      height;
+
+  public:
+    auto get_parent() const -> const impl::GraphicBase&;
+    auto get_texcoords() const -> const impl::TexCoords&;
+    auto get_width(const MetaScreen& screen) const -> int;
+    auto get_height(const MetaScreen& screen) const -> int;
+    auto draw(Screen& screen, const Point& point) const -> void;
+    auto draw_rect(Screen& screen, const Rectangle& rect) const -> void;
+    auto draw_fit_rect(Screen& screen, const Rectangle& rect) const -> void;
+    auto draw_transformed(Screen& screen, const std::array<Point, 4>& vertices) const -> void;
+
+    operator bool() const;
+
+    SubGraphic() = default;
+    // rect is {x, y, width, height} in pixels of the parent
+    SubGraphic(std::shared_ptr<const impl::GraphicBase> parent, const std::array<int, 4>& rect);
+};
+} // namespace gawl
@@ -9,13 +9,17 @@ auto TextRenderShader::set_text_color(const Color& text_color) -> void {
     color = text_color;
 }
 
-auto TextRenderShader::set_parameters(const GLuint shader) -> void {
-    const auto l = glGetUniformLocation(shader, "text_color");
-    glUniform4f(l, color[0], color[1], color[2], color[3]);
+auto TextRenderShader::get_text_color() const -> const Color& {
+    return color;
+}
+
+auto TextRenderShader::set_parameters(const GLuint /*shader*/) -> void {
+    text_color.set(color);
 };
 
 auto TextRenderShader::init() -> bool {
     ensure(GraphicShader::init(textrender_vertex_shader_source, textrender_fragment_shader_source));
+    ensure(text_color.init(shader_program, "text_color"));
     FT_Init_FreeType(std::bit_cast<FT_Library*>(&freetype));
     return true;
 }
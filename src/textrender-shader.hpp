@@ -5,7 +5,8 @@
 namespace gawl::impl {
 class TextRenderShader : public GraphicShader {
   private:
-    Color color;
+    Color       color;
+    UniformVec4 text_color;
 
   public:
     void* freetype = nullptr; // FT_Library
@@ -13,6 +14,7 @@ class TextRenderShader : public GraphicShader {
     auto set_parameters(const GLuint shader) -> void override;
 
     auto set_text_color(const Color& text_color) -> void;
+    auto get_text_color() const -> const Color&;
     auto init() -> bool;
 
     ~TextRenderShader();
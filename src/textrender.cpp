@@ -217,8 +217,11 @@ auto TextRender::draw(Screen& screen, const Point& point, const Color& color, co
     auto       pen   = point;
     auto       rx    = Rectangle{point, point};
 
+    // glyphs outside of this are measured but not drawn
+    auto visible = std::optional<Rectangle>();
     if(!params.dry) {
         set_char_color(color);
+        visible = screen.get_visible_rect();
     }
 
     for(auto i = 0uz; i < text.size(); i += 1) {
@@ -235,8 +238,11 @@ auto TextRender::draw(Screen& screen, const Point& point, const Color& color, co
         rx.b.y         = std::max(rx.b.y, y_b);
 
         if(!params.dry) {
-            if(!params.callback || !params.callback(i, {{x_a, y_a}, {x_b, y_b}}, chara)) {
-                chara.draw_rect(screen, {{x_a, y_a}, {x_b, y_b}});
+            const auto glyph = Rectangle{{x_a, y_a}, {x_b, y_b}};
+            if(!params.callback || !params.callback(i, glyph, chara)) {
+                if(!visible || glyph.intersects(*visible)) {
+                    chara.draw_rect(screen, glyph);
+                }
             }
         }
 
@@ -287,7 +293,7 @@ auto TextRender::draw_wrapped(Screen& screen, const Rectangle& rect, const doubl
     const auto y_offset     = params.align_y == Align::Left ? 0.0 : params.align_y == Align::Right ? rect_height - total_height
                                                                                                    : (rect_height - total_height) / 2.0;
 
-    const auto visible_rect = Viewport(screen.get_viewport()).to_rectangle() * (1.0 / screen.get_scale()) &= rect;
+    const auto visible_rect = screen.get_visible_rect().value_or(rect) &= rect;
     const auto y_pos_begin  = rect.a.y + y_offset;
     const auto index_begin  = int(std::max(0.0, -(y_pos_begin - visible_rect.a.y) / line_height));
     const auto index_end    = int(std::min(double(lines.size()), index_begin + (visible_rect.height() + line_height - 1) / line_height));
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cstring>
+
+#include "texture-atlas.hpp"
+
+namespace gawl {
+namespace {
+// surround the image with 1px copy of its edges, so that linear filtering does not bleed neighbors
+auto extrude(const PixelBuffer& buffer) -> PixelBuffer {
+    const auto w   = buffer.width + 2;
+    const auto h   = buffer.height + 2;
+    auto       ret = PixelBuffer{w, h, PixelStorage(w * h * 4)};
+    for(auto y = 0uz; y < h; y += 1) {
+        const auto sy  = std::clamp(y, 1uz, buffer.height) - 1;
+        const auto src = buffer.data.data() + sy * buffer.width * 4;
+        const auto dst = ret.data.data() + y * w * 4;
+        std::memcpy(dst, src, 4);
+        std::memcpy(dst + 4, src, buffer.width * 4);
+        std::memcpy(dst + (w - 1) * 4, src + (buffer.width - 1) * 4, 4);
+    }
+    return ret;
+}
+} // namespace
+
+auto TextureAtlas::allocate(Page& page, const int width, const int height) -> std::optional<std::array<int, 2>> {
+    for(auto& shelf : page.shelves) {
+        // do not waste tall shelves for short images
+        if(shelf.height < height || shelf.height > height * 2 || shelf.used_width + width > page_size) {
+            continue;
+        }
+        const auto x = shelf.used_width;
+        shelf.used_width += width;
+        return std::array{x, shelf.y};
+    }
+    if(page.used_height + height > page_size) {
+        return std::nullopt;
+    }
+    page.shelves.push_back({page.used_height, height, width});
+    page.used_height += height;
+    return std::array{0, page.shelves.back().y};
+}
+
+auto TextureAtlas::add(const PixelBuffer& buffer) -> std::optional<AtlasGraphic> {
+    const auto w = int(buffer.width) + 2;
+    const auto h = int(buffer.height) + 2;
+    if(w > page_size || h > page_size) {
+        return std::nullopt;
+    }
+
+    auto page     = (Page*)(nullptr);
+    auto position = std::optional<std::array<int, 2>>();
+    for(auto& p : pages) {
+        if((position = allocate(p, w, h))) {
+            page = &p;
+            break;
+        }
+    }
+    if(page == nullptr) {
+        page     = &pages.emplace_back(Page{.graphic = std::shared_ptr<Graphic>(new Graphic(page_size, page_size))});
+        position = allocate(*page, w, h);
+    }
+    const auto [x, y] = *position;
+    page->graphic->update_region(extrude(buffer), x, y);
+    return AtlasGraphic(page->graphic, {x + 1, y + 1, int(buffer.width), int(buffer.height)});
+}
+
+auto TextureAtlas::get_num_pages() const -> size_t {
+    return pages.size();
+}
+
+TextureAtlas::TextureAtlas(const int page_size)
+    : page_size(page_size) {}
+} // namespace gawl
@@ -0,0 +1,38 @@
+#pragma once
+#include <memory>
+
+#include "graphic.hpp"
+#include "sub-graphic.hpp"
+
+namespace gawl {
+using AtlasGraphic = SubGraphic;
+
+// packs small images into shared textures
+class TextureAtlas {
+  private:
+    struct Shelf {
+        int y;
+        int height;
+        int used_width;
+    };
+
+    struct Page {
+        std::shared_ptr<Graphic> graphic;
+        std::vector<Shelf>       shelves;
+        int                      used_height = 0;
+    };
+
+    std::vector<Page> pages;
+    int               page_size;
+
+    auto allocate(Page& page, int width, int height) -> std::optional<std::array<int, 2>>;
+
+  public:
+    // returns nullopt if the buffer does not fit in a page
+    // the page is kept alive by the returned views
+    auto add(const PixelBuffer& buffer) -> std::optional<AtlasGraphic>;
+    auto get_num_pages() const -> size_t;
+
+    TextureAtlas(int page_size = 2048);
+};
+} // namespace gawl
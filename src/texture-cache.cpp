@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <format>
+
+#include "batch.hpp"
+#include "global.hpp"
+#include "recorder.hpp"
+#include "texture-cache.hpp"
+
+namespace gawl {
+auto CachedGraphic::get() const -> const Graphic* {
+    return cache->touch(*entry);
+}
+
+auto CachedGraphic::record(Screen& screen, std::function<void(const CachedGraphic& self, Screen& screen)> call) const -> bool {
+    const auto recorder = screen.get_recorder();
+    if(recorder == nullptr) {
+        return false;
+    }
+    impl::flush_pending_batch();
+    recorder->record_call([self = *this, call = std::move(call)](Screen& screen) { call(self, screen); });
+    return true;
+}
+
+auto CachedGraphic::get_key() const -> const std::string& {
+    return entry->key;
+}
+
+auto CachedGraphic::get_width(const MetaScreen& screen) const -> int {
+    return entry->width / screen.get_scale();
+}
+
+auto CachedGraphic::get_height(const MetaScreen& screen) const -> int {
+    return entry->height / screen.get_scale();
+}
+
+auto CachedGraphic::draw(Screen& screen, const Point& point) const -> void {
+    if(record(screen, [point](const CachedGraphic& self, Screen& screen) { self.draw(screen, point); })) {
+        return;
+    }
+    if(const auto graphic = get(); graphic != nullptr) {
+        graphic->draw(screen, point);
+    }
+}
+
+auto CachedGraphic::draw_rect(Screen& screen, const Rectangle& rect) const -> void {
+    if(record(screen, [rect](const CachedGraphic& self, Screen& screen) { self.draw_rect(screen, rect); })) {
+        return;
+    }
+    if(const auto graphic = get(); graphic != nullptr) {
+        graphic->draw_rect(screen, rect);
+    }
+}
+
+auto CachedGraphic::draw_fit_rect(Screen& screen, const Rectangle& rect) const -> void {
+    if(record(screen, [rect](const CachedGraphic& self, Screen& screen) { self.draw_fit_rect(screen, rect); })) {
+        return;
+    }
+    if(const auto graphic = get(); graphic != nullptr) {
+        graphic->draw_fit_rect(screen, rect);
+    }
+}
+
+auto CachedGraphic::draw_transformed(Screen& screen, const std::array<Point, 4>& vertices) const -> void {
+    if(record(screen, [vertices](const CachedGraphic& self, Screen& screen) { self.draw_transformed(screen, vertices); })) {
+        return;
+    }
+    if(const auto graphic = get(); graphic != nullptr) {
+        graphic->draw_transformed(screen, vertices);
+    }
+}
+
+CachedGraphic::operator bool() const {
+    return entry != nullptr;
+}
+
+auto TextureCache::wrap(std::shared_ptr<impl::TextureCacheEntry> entry) -> CachedGraphic {
+    auto ret  = CachedGraphic();
+    ret.cache = this;
+    ret.entry = std::move(entry);
+    return ret;
+}
+
+auto TextureCache::insert(std::shared_ptr<impl::TextureCacheEntry> entry) -> std::optional<CachedGraphic> {
+    if(!load(*entry)) {
+        return std::nullopt;
+    }
+    entries.emplace(entry->key, entry);
+    return wrap(std::move(entry));
+}
+
+auto TextureCache::load(impl::TextureCacheEntry& entry) -> bool {
+    auto buffer = entry.reload();
+    if(!buffer) {
+        return false;
+    }
+    entry.graphic.emplace(*buffer);
+    entry.width  = buffer->width;
+    entry.height = buffer->height;
+    entry.bytes  = buffer->width * buffer->height * 4;
+    usage += entry.bytes;
+    return true;
+}
+
+auto TextureCache::touch(impl::TextureCacheEntry& entry) -> const Graphic* {
+    if(frame != impl::frame_count) {
+        // previous frame is finished, keep its working set and drop older ones
+        evict();
+        frame = impl::frame_count;
+    }
+    if(!entry.graphic && !load(entry)) {
+        return nullptr;
+    }
+    entry.last_used = frame;
+    return &*entry.graphic;
+}
+
+auto TextureCache::evict() -> void {
+    while(usage > budget) {
+        auto victim = (impl::TextureCacheEntry*)(nullptr);
+        for(const auto& [key, entry] : entries) {
+            // the working set of the current frame stays even if it exceeds the budget
+            if(!entry->graphic || entry->last_used == frame) {
+                continue;
+            }
+            if(victim == nullptr || entry->last_used < victim->last_used) {
+                victim = entry.get();
+            }
+        }
+        if(victim == nullptr) {
+            return;
+        }
+        victim->graphic.reset();
+        usage -= victim->bytes;
+    }
+}
+
+auto TextureCache::get(const std::string& key) -> std::optional<CachedGraphic> {
+    if(const auto p = entries.find(key); p != entries.end()) {
+        return wrap(p->second);
+    }
+    return insert(std::shared_ptr<impl::TextureCacheEntry>(new impl::TextureCacheEntry{.key = key, .reload = [this, key]() { return loader(key); }}));
+}
+
+auto TextureCache::get_blob(const std::span<const std::byte> blob) -> std::optional<CachedGraphic> {
+    const auto hash = std::hash<std::string_view>()(std::string_view((const char*)(blob.data()), blob.size()));
+    // on a hash collision, probe the next key
+    for(auto probe = 0uz;; probe += 1) {
+        auto key = std::format("blob:{:016x}:{}:{}", hash, blob.size(), probe);
+        if(const auto p = entries.find(key); p != entries.end()) {
+            if(std::ranges::equal(p->second->blob, blob)) {
+                return wrap(p->second);
+            }
+            continue;
+        }
+
+        auto entry  = std::shared_ptr<impl::TextureCacheEntry>(new impl::TextureCacheEntry{.key = std::move(key), .blob = {blob.begin(), blob.end()}});
+        entry->reload = [&data = entry->blob]() { return PixelBuffer::from_blob(data); };
+        return insert(std::move(entry));
+    }
+}
+
+auto TextureCache::set_budget(const size_t bytes) -> void {
+    budget = bytes;
+    evict();
+}
+
+auto TextureCache::get_usage() const -> size_t {
+    return usage;
+}
+
+auto TextureCache::purge() -> void {
+    for(auto i = entries.begin(); i != entries.end();) {
+        if(i->second.use_count() == 1) {
+            if(i->second->graphic) {
+                usage -= i->second->bytes;
+            }
+            i = entries.erase(i);
+        } else {
+            i = std::next(i);
+        }
+    }
+}
+
+TextureCache::TextureCache(const size_t budget, Loader loader)
+    : loader(loader ? std::move(loader) : [](const std::string& path) { return PixelBuffer::from_file(path.data()); }),
+      budget(budget) {}
+} // namespace gawl
@@ -0,0 +1,87 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "graphic.hpp"
+
+namespace gawl {
+namespace impl {
+struct TextureCacheEntry {
+    std::string                                 key;
+    std::function<std::optional<PixelBuffer>()> reload;
+    std::vector<std::byte>                      blob; // encoded image if created by get_blob()
+    std::optional<Graphic>                      graphic; // nullopt if evicted
+    size_t                                      width     = 0; // known without the texture
+    size_t                                      height    = 0;
+    size_t                                      bytes     = 0;
+    uint64_t                                    last_used = 0; // frame of the latest draw
+};
+} // namespace impl
+
+class TextureCache;
+
+// shared handle to a cached texture
+// the texture is reloaded on demand if it was evicted, size queries never reload it
+// command lists hold a handle for each recorded draw and resolve the texture at replay
+class CachedGraphic {
+  private:
+    friend class TextureCache;
+
+    TextureCache*                            cache = nullptr;
+    std::shared_ptr<impl::TextureCacheEntry> entry;
+
+    // for drawing, marks the entry as used in the current frame
+    auto get() const -> const Graphic*;
+    // the texture may be evicted or reloaded before replays, so draws to recorders are recorded as calls
+    // returns false if the screen is not recording
+    auto record(Screen& screen, std::function<void(const CachedGraphic& self, Screen& screen)> call) const -> bool;
+
+  public:
+    auto get_key() const -> const std::string&;
+    auto get_width(const MetaScreen& screen) const -> int;
+    auto get_height(const MetaScreen& screen) const -> int;
+    auto draw(Screen& screen, const Point& point) const -> void;
+    auto draw_rect(Screen& screen, const Rectangle& rect) const -> void;
+    auto draw_fit_rect(Screen& screen, const Rectangle& rect) const -> void;
+    auto draw_transformed(Screen& screen, const std::array<Point, 4>& vertices) const -> void;
+
+    operator bool() const;
+};
+
+// deduplicates textures by key and keeps their total size under the budget
+// eviction is deferred to the first draw of the next frame, textures drawn in the latest frame are never evicted
+// must outlive the handles it created
+class TextureCache {
+  public:
+    using Loader = std::function<std::optional<PixelBuffer>(const std::string& key)>;
+
+  private:
+    friend class CachedGraphic;
+
+    std::unordered_map<std::string, std::shared_ptr<impl::TextureCacheEntry>> entries;
+    Loader                                                                     loader;
+    size_t                                                                     budget;
+    size_t                                                                     usage = 0;
+    uint64_t                                                                   frame = 0; // impl::frame_count seen by the latest draw
+
+    auto wrap(std::shared_ptr<impl::TextureCacheEntry> entry) -> CachedGraphic;
+    auto insert(std::shared_ptr<impl::TextureCacheEntry> entry) -> std::optional<CachedGraphic>;
+    auto load(impl::TextureCacheEntry& entry) -> bool;
+    auto touch(impl::TextureCacheEntry& entry) -> const Graphic*;
+    auto evict() -> void;
+
+  public:
+    // key is passed to the loader, a file path by default
+    auto get(const std::string& key) -> std::optional<CachedGraphic>;
+    // key is the hash of the encoded image, contents are compared on a hit
+    auto get_blob(std::span<const std::byte> blob) -> std::optional<CachedGraphic>;
+    auto set_budget(size_t bytes) -> void;
+    auto get_usage() const -> size_t;
+    // forget entries no handle refers to
+    auto purge() -> void;
+
+    TextureCache(size_t budget = 256 * 1024 * 1024, Loader loader = nullptr);
+};
+} // namespace gawl
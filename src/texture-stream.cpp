@@ -0,0 +1,120 @@
+#include <cstring>
+
+#include <coop/promise.hpp>
+
+#include "global.hpp"
+#include "macros/unwrap.hpp"
+#include "texture-stream.hpp"
+
+namespace gawl {
+namespace {
+auto wait_fence(std::optional<Fence>& fence) -> coop::Async<void> {
+    if(!fence) {
+        co_return;
+    }
+    co_await fence->wait();
+    fence.reset();
+}
+} // namespace
+
+auto TextureStream::reallocate(Slot& slot, const size_t size) -> bool {
+    if(slot.pbo != 0) {
+        glDeleteBuffers(1, &slot.pbo);
+    }
+    glGenBuffers(1, &slot.pbo);
+    const auto pbbinder = impl::PixelUnpackBinder(slot.pbo);
+    if(persistent) {
+        constexpr auto flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_PIXEL_UNPACK_BUFFER, size, nullptr, flags);
+        slot.mapped = (std::byte*)(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, flags));
+        ensure(slot.mapped != nullptr);
+    } else {
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        slot.mapped = nullptr;
+    }
+    slot.capacity = size;
+    return true;
+}
+
+auto TextureStream::map(Slot& slot, const size_t size) -> bool {
+    if(slot.capacity < size) {
+        ensure(reallocate(slot, size));
+    }
+    if(persistent) {
+        return true;
+    }
+    const auto pbbinder = impl::PixelUnpackBinder(slot.pbo);
+    slot.mapped         = (std::byte*)(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+    ensure(slot.mapped != nullptr);
+    return true;
+}
+
+auto TextureStream::reserve(const size_t width, const size_t height) -> coop::Async<std::optional<Staging>> {
+    constexpr auto error_value = std::nullopt;
+
+    auto index = slots.size();
+    for(auto i = 0uz; i < slots.size(); i += 1) {
+        const auto n = (next + i) % slots.size();
+        if(!slots[n].reserved) {
+            index = n;
+            break;
+        }
+    }
+    co_ensure_v(index < slots.size());
+    next = (index + 1) % slots.size();
+
+    auto& slot    = slots[index];
+    slot.reserved = true;
+    co_await wait_fence(slot.fence);
+
+    const auto size = width * height * 4;
+    if(!map(slot, size)) {
+        slot.reserved = false;
+        co_return error_value;
+    }
+    co_return Staging{index, width, height, {slot.mapped, size}};
+}
+
+auto TextureStream::submit(const Staging& staging) -> Graphic {
+    auto&      slot     = slots[staging.slot];
+    const auto pbbinder = impl::PixelUnpackBinder(slot.pbo);
+    if(!persistent) {
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        slot.mapped = nullptr;
+    }
+    auto graphic = Graphic(nullptr, staging.width, staging.height);
+    slot.fence   = Fence::create();
+    if(!slot.fence) {
+        // the buffer would be handed out again while the gpu may still be reading it
+        glFinish();
+    }
+    slot.reserved = false;
+    return graphic;
+}
+
+auto TextureStream::upload(const PixelBuffer& buffer) -> coop::Async<std::optional<Graphic>> {
+    constexpr auto error_value = std::nullopt;
+
+    co_unwrap_v(staging, co_await reserve(buffer.width, buffer.height));
+    std::memcpy(staging.memory.data(), buffer.data.data(), staging.memory.size());
+    co_return submit(staging);
+}
+
+auto TextureStream::wait_idle() -> coop::Async<void> {
+    for(auto& slot : slots) {
+        co_await wait_fence(slot.fence);
+    }
+}
+
+TextureStream::TextureStream(const size_t num_slots)
+    : slots(num_slots),
+      persistent(impl::global->caps.buffer_storage) {}
+
+TextureStream::~TextureStream() {
+    for(auto& slot : slots) {
+        if(slot.pbo != 0) {
+            glDeleteBuffers(1, &slot.pbo);
+        }
+    }
+}
+} // namespace gawl
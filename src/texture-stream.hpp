@@ -0,0 +1,53 @@
+#pragma once
+#include <span>
+#include <vector>
+
+#include <coop/generator.hpp>
+
+#include "graphic.hpp"
+#include "wayland/fence.hpp"
+
+namespace gawl {
+// ring of pixel unpack buffers for asynchronous texture uploads
+// must be created and used on the thread which owns the gl context
+class TextureStream {
+  public:
+    struct Staging {
+        size_t               slot;
+        size_t               width;
+        size_t               height;
+        std::span<std::byte> memory; // decoders can write RGBA pixels here from any thread
+    };
+
+  private:
+    struct Slot {
+        GLuint               pbo      = 0;
+        size_t               capacity = 0;
+        std::byte*           mapped   = nullptr;
+        std::optional<Fence> fence;
+        bool                 reserved = false;
+    };
+
+    std::vector<Slot> slots;
+    size_t            next = 0;
+    bool              persistent;
+
+    auto reallocate(Slot& slot, size_t size) -> bool;
+    auto map(Slot& slot, size_t size) -> bool;
+
+  public:
+    // waits until the gpu finished reading the next free staging buffer
+    // fails if every staging buffer is reserved and not submitted yet
+    auto reserve(size_t width, size_t height) -> coop::Async<std::optional<Staging>>;
+    // returned graphic can be drawn immediately on this context,
+    // the actual copy completes asynchronously
+    auto submit(const Staging& staging) -> Graphic;
+    auto upload(const PixelBuffer& buffer) -> coop::Async<std::optional<Graphic>>;
+    // waits until all submitted uploads are finished
+    auto wait_idle() -> coop::Async<void>;
+
+    TextureStream(size_t num_slots = 3);
+    TextureStream(TextureStream&&) = delete;
+    ~TextureStream();
+};
+} // namespace gawl
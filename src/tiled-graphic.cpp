@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <cmath>
+
+#include <coop/promise.hpp>
+
+#include "misc.hpp"
+#include "tiled-graphic.hpp"
+
+namespace gawl {
+namespace {
+constexpr auto coord_bits = 28;
+constexpr auto coord_mask = (uint64_t(1) << coord_bits) - 1;
+
+auto encode_key(const int level, const int x, const int y) -> uint64_t {
+    return uint64_t(level) << coord_bits * 2 | uint64_t(y) << coord_bits | uint64_t(x);
+}
+
+auto decode_key(const uint64_t key) -> std::array<int, 3> {
+    return {int(key >> coord_bits * 2), int(key & coord_mask), int(key >> coord_bits & coord_mask)};
+}
+} // namespace
+
+auto PixelBufferTileSource::get_width() const -> size_t {
+    return width;
+}
+
+auto PixelBufferTileSource::get_height() const -> size_t {
+    return height;
+}
+
+auto PixelBufferTileSource::decode_tile(const int level, const std::array<int, 4>& rect) -> std::optional<PixelBuffer> {
+    const auto lock = std::lock_guard(mutex);
+    while(levels.size() <= size_t(level)) {
+        levels.push_back(levels.back().downscale_half());
+    }
+    return levels[level].crop(rect);
+}
+
+PixelBufferTileSource::PixelBufferTileSource(PixelBuffer buffer)
+    : width(buffer.width),
+      height(buffer.height) {
+    levels.emplace_back(std::move(buffer));
+}
+
+auto TiledGraphic::get_level_size(const int level) const -> std::array<size_t, 2> {
+    const auto f = size_t(1) << level;
+    return {(source->get_width() + f - 1) / f, (source->get_height() + f - 1) / f};
+}
+
+auto TiledGraphic::collect_tiles(const Rectangle& rect, const Rectangle& visible, const int level) const -> std::vector<TileRect> {
+    const auto w           = double(source->get_width());
+    const auto h           = double(source->get_height());
+    const auto [lw, lh]    = get_level_size(level);
+    const auto span        = double(tile_size << level); // source pixels per tile
+    const auto sx          = rect.width() / w;
+    const auto sy          = rect.height() / h;
+    const auto num_tiles_x = int((lw + tile_size - 1) / tile_size);
+    const auto num_tiles_y = int((lh + tile_size - 1) / tile_size);
+    const auto tx_begin    = std::clamp(int((visible.a.x - rect.a.x) / sx / span), 0, num_tiles_x);
+    const auto tx_end      = std::clamp(int(std::ceil((visible.b.x - rect.a.x) / sx / span)), 0, num_tiles_x);
+    const auto ty_begin    = std::clamp(int((visible.a.y - rect.a.y) / sy / span), 0, num_tiles_y);
+    const auto ty_end      = std::clamp(int(std::ceil((visible.b.y - rect.a.y) / sy / span)), 0, num_tiles_y);
+
+    auto ret = std::vector<TileRect>();
+    for(auto ty = ty_begin; ty < ty_end; ty += 1) {
+        const auto y0 = ty * span;
+        const auto y1 = std::min((ty + 1) * span, h);
+        for(auto tx = tx_begin; tx < tx_end; tx += 1) {
+            const auto x0 = tx * span;
+            const auto x1 = std::min((tx + 1) * span, w);
+            ret.push_back({encode_key(level, tx, ty), {{rect.a.x + x0 * sx, rect.a.y + y0 * sy}, {rect.a.x + x1 * sx, rect.a.y + y1 * sy}}});
+        }
+    }
+    return ret;
+}
+
+auto TiledGraphic::draw_tiles(Screen& screen, const std::span<const TileRect> targets) -> void {
+    for(const auto& target : targets) {
+        const auto p = tiles.find(target.key);
+        if(p == tiles.end()) {
+            pending.push_back(target.key);
+            continue;
+        }
+        p->second.graphic.draw_rect(screen, target.rect);
+        p->second.last_used = frame;
+    }
+}
+
+auto TiledGraphic::evict() -> void {
+    while(tiles.size() > max_resident_tiles) {
+        auto victim = tiles.end();
+        for(auto i = tiles.begin(); i != tiles.end(); i = std::next(i)) {
+            if(i->second.last_used != frame && (victim == tiles.end() || i->second.last_used < victim->second.last_used)) {
+                victim = i;
+            }
+        }
+        if(victim == tiles.end()) {
+            // everything is visible
+            return;
+        }
+        tiles.erase(victim);
+    }
+}
+
+auto TiledGraphic::get_width(const MetaScreen& screen) const -> int {
+    return source->get_width() / screen.get_scale();
+}
+
+auto TiledGraphic::get_height(const MetaScreen& screen) const -> int {
+    return source->get_height() / screen.get_scale();
+}
+
+auto TiledGraphic::draw(Screen& screen, const Point& point) -> void {
+    draw_rect(screen, {{point.x, point.y}, {point.x + source->get_width(), point.y + source->get_height()}});
+}
+
+auto TiledGraphic::draw_rect(Screen& screen, const Rectangle& rect) -> void {
+    frame += 1;
+    pending.clear();
+
+    const auto scale   = screen.get_scale();
+    const auto visible = screen.get_visible_rect().value_or(rect) &= rect;
+    if(visible.width() <= 0 || visible.height() <= 0) {
+        return;
+    }
+
+    const auto ratio  = source->get_width() / (rect.width() * scale); // source pixels per screen pixel
+    const auto level  = std::clamp(int(std::floor(std::log2(std::max(ratio, 1.0)))), 0, num_levels - 1);
+    const auto wanted = collect_tiles(rect, visible, level);
+
+    // draw the coarsest level below the missing tiles as a placeholder
+    const auto missing = std::ranges::any_of(wanted, [this](const TileRect& t) { return !tiles.contains(t.key); });
+    if(missing && level != num_levels - 1) {
+        draw_tiles(screen, collect_tiles(rect, visible, num_levels - 1));
+    }
+    draw_tiles(screen, wanted);
+
+    if(!pending.empty()) {
+        requested.notify();
+    }
+}
+
+auto TiledGraphic::draw_fit_rect(Screen& screen, const Rectangle& rect) -> void {
+    draw_rect(screen, calc_fit_rect(rect, source->get_width(), source->get_height()));
+}
+
+auto TiledGraphic::load_pending() -> coop::Async<bool> {
+    auto loaded = false;
+    for(const auto key : std::exchange(pending, {})) {
+        if(tiles.contains(key)) {
+            continue;
+        }
+        const auto [level, tx, ty] = decode_key(key);
+        const auto [lw, lh]        = get_level_size(level);
+        const auto rect            = std::array{tx * tile_size, ty * tile_size, std::min(tile_size, int(lw) - tx * tile_size), std::min(tile_size, int(lh) - ty * tile_size)};
+
+        auto buffer = co_await decoder.run([this, level, rect]() { return source->decode_tile(level, rect); });
+        if(!buffer) {
+            continue;
+        }
+        auto graphic = co_await stream.upload(*buffer);
+        if(!graphic) {
+            continue;
+        }
+        tiles.emplace(key, Tile{std::move(*graphic), frame});
+        loaded = true;
+    }
+    evict();
+    co_return loaded;
+}
+
+auto TiledGraphic::run(Window& window) -> coop::Async<void> {
+    while(true) {
+        if(pending.empty()) {
+            co_await requested;
+        }
+        if(co_await load_pending()) {
+            window.refresh();
+        }
+    }
+}
+
+TiledGraphic::TiledGraphic(std::shared_ptr<TileSource> source, const int tile_size, const size_t max_resident_tiles)
+    : source(std::move(source)),
+      decoder([] {}),
+      max_resident_tiles(max_resident_tiles) {
+    auto max_texture_size = GLint(0);
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_texture_size);
+    this->tile_size = std::min(tile_size, int(max_texture_size));
+
+    const auto longest = std::max(this->source->get_width(), this->source->get_height());
+    num_levels         = 1;
+    while(((longest - 1) >> (num_levels - 1)) + 1 > size_t(this->tile_size)) {
+        num_levels += 1;
+    }
+}
+} // namespace gawl
@@ -0,0 +1,86 @@
+#pragma once
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <coop/generator.hpp>
+#include <coop/single-event.hpp>
+#include <coop/thread.hpp>
+
+#include "texture-stream.hpp"
+#include "window.hpp"
+
+namespace gawl {
+class TileSource {
+  public:
+    virtual auto get_width() const -> size_t  = 0;
+    virtual auto get_height() const -> size_t = 0;
+    // rect is {x, y, width, height} in pixels of the mip level
+    // level 0 is the full resolution, level n is downscaled by 2^n
+    // called from the decoder thread
+    virtual auto decode_tile(int level, const std::array<int, 4>& rect) -> std::optional<PixelBuffer> = 0;
+
+    virtual ~TileSource() {}
+};
+
+// keeps whole image and its mip pyramid in memory
+// levels are built on demand by the decoder thread
+class PixelBufferTileSource : public TileSource {
+  private:
+    std::mutex               mutex;
+    std::vector<PixelBuffer> levels; // guarded by mutex
+    size_t                   width;
+    size_t                   height;
+
+  public:
+    auto get_width() const -> size_t override;
+    auto get_height() const -> size_t override;
+    auto decode_tile(int level, const std::array<int, 4>& rect) -> std::optional<PixelBuffer> override;
+
+    PixelBufferTileSource(PixelBuffer buffer);
+};
+
+// image split into tiles, only the visible ones are kept resident
+class TiledGraphic {
+  private:
+    struct Tile {
+        Graphic  graphic;
+        uint64_t last_used;
+    };
+
+    struct TileRect {
+        uint64_t  key;
+        Rectangle rect;
+    };
+
+    std::shared_ptr<TileSource>        source;
+    std::unordered_map<uint64_t, Tile> tiles;
+    std::vector<uint64_t>              pending; // requested in the latest draw
+    TextureStream                      stream;
+    coop::Thread                       decoder;
+    coop::SingleEvent                  requested;
+    int                                tile_size;
+    int                                num_levels;
+    size_t                             max_resident_tiles;
+    uint64_t                           frame = 0;
+
+    auto get_level_size(int level) const -> std::array<size_t, 2>;
+    auto collect_tiles(const Rectangle& rect, const Rectangle& visible, int level) const -> std::vector<TileRect>;
+    auto draw_tiles(Screen& screen, std::span<const TileRect> targets) -> void;
+    auto evict() -> void;
+
+  public:
+    auto get_width(const MetaScreen& screen) const -> int;
+    auto get_height(const MetaScreen& screen) const -> int;
+    auto draw(Screen& screen, const Point& point) -> void;
+    auto draw_rect(Screen& screen, const Rectangle& rect) -> void;
+    auto draw_fit_rect(Screen& screen, const Rectangle& rect) -> void;
+    // decode and upload the tiles requested by the latest draw
+    // returns true if any tile became resident
+    auto load_pending() -> coop::Async<bool>;
+    // keep loading requested tiles and refreshing the window
+    auto run(Window& window) -> coop::Async<void>;
+
+    TiledGraphic(std::shared_ptr<TileSource> source, int tile_size = 512, size_t max_resident_tiles = 256);
+};
+} // namespace gawl
@@ -0,0 +1,45 @@
+#include <cmath>
+#include <numbers>
+
+#include "transform.hpp"
+
+namespace gawl {
+auto Transform::translate(const double x, const double y) -> Transform {
+    return {{1, 0, x, 0, 1, y}};
+}
+
+auto Transform::scale(const double x, const double y) -> Transform {
+    return {{x, 0, 0, 0, y, 0}};
+}
+
+auto Transform::rotate(const double angle) -> Transform {
+    const auto a = angle * 2 * std::numbers::pi;
+    const auto s = std::sin(a);
+    const auto c = std::cos(a);
+    return {{c, -s, 0, s, c, 0}};
+}
+
+auto Transform::apply(const Point& p) const -> Point {
+    return {m[0] * p.x + m[1] * p.y + m[2], m[3] * p.x + m[4] * p.y + m[5]};
+}
+
+auto Transform::apply(const Rectangle& r) const -> Rectangle {
+    const auto p = r.to_points();
+    return bounding_box(std::array{apply(p[0]), apply(p[1]), apply(p[2]), apply(p[3])});
+}
+
+auto Transform::get_scale() const -> double {
+    return std::sqrt(std::abs(m[0] * m[4] - m[1] * m[3]));
+}
+
+auto Transform::operator*(const Transform& o) const -> Transform {
+    return {{
+        m[0] * o.m[0] + m[1] * o.m[3],
+        m[0] * o.m[1] + m[1] * o.m[4],
+        m[0] * o.m[2] + m[1] * o.m[5] + m[2],
+        m[3] * o.m[0] + m[4] * o.m[3],
+        m[3] * o.m[1] + m[4] * o.m[4],
+        m[3] * o.m[2] + m[4] * o.m[5] + m[5],
+    }};
+}
+} // namespace gawl
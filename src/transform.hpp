@@ -0,0 +1,26 @@
+#pragma once
+#include <array>
+
+#include "rect.hpp"
+
+namespace gawl {
+// 2d affine transform
+// {x, y} -> {m[0] * x + m[1] * y + m[2], m[3] * x + m[4] * y + m[5]}
+struct Transform {
+    std::array<double, 6> m = {1, 0, 0, 0, 1, 0};
+
+    static auto translate(double x, double y) -> Transform;
+    static auto scale(double x, double y) -> Transform;
+    // angle is in turns, same as Point::rotate()
+    static auto rotate(double angle) -> Transform;
+
+    auto apply(const Point& p) const -> Point;
+    // bounding box of the transformed corners
+    auto apply(const Rectangle& r) const -> Rectangle;
+    // scale factor of lengths, exact for similarity transforms
+    auto get_scale() const -> double;
+
+    // apply o first, then this
+    auto operator*(const Transform& o) const -> Transform;
+};
+} // namespace gawl
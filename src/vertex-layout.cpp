@@ -0,0 +1,38 @@
+#include <cstring>
+
+#include "macros/assert.hpp"
+#include "vertex-layout.hpp"
+
+namespace gawl::impl {
+auto resolve_attributes(const GLuint program, const std::span<const AttributeDesc> descs, const std::span<GLint> locations) -> bool {
+    for(auto i = 0uz; i < descs.size(); i += 1) {
+        ensure(descs[i].consecutive, "fields of attribute {} are not consecutive", descs[i].name);
+        locations[i] = glGetAttribLocation(program, descs[i].name);
+        ensure(locations[i] != -1, "no such attribute {}", descs[i].name);
+    }
+    return true;
+}
+
+auto enable_attributes(const std::span<const GLint> locations, const GLuint divisor) -> void {
+    for(const auto location : locations) {
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, divisor);
+    }
+}
+
+auto set_attribute_pointers(const std::span<const AttributeDesc> descs, const std::span<const GLint> locations, const GLsizei stride, const size_t offset) -> void {
+    for(auto i = 0uz; i < descs.size(); i += 1) {
+        const auto& desc = descs[i];
+        glVertexAttribPointer(locations[i], desc.components, desc.type, desc.normalized, stride, (void*)(offset + desc.offset));
+    }
+}
+
+auto pack_points(const std::span<const Point> points, void* const dst, const size_t stride) -> void {
+    auto out = static_cast<std::byte*>(dst);
+    for(const auto& p : points) {
+        const auto v = std::array{GLfloat(p.x), GLfloat(p.y)};
+        std::memcpy(out, v.data(), sizeof(v));
+        out += stride;
+    }
+}
+} // namespace gawl::impl
@@ -0,0 +1,149 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+#include "binder.hpp"
+#include "point.hpp"
+
+namespace gawl::impl {
+struct AttributeDesc {
+    const char* name;
+    GLint       components;
+    GLenum      type;
+    GLboolean   normalized;
+    size_t      offset;
+    bool        consecutive; // false if grouped fields have padding between them
+};
+
+auto resolve_attributes(GLuint program, std::span<const AttributeDesc> descs, std::span<GLint> locations) -> bool;
+// enable the attributes of the bound vertex array
+auto enable_attributes(std::span<const GLint> locations, GLuint divisor) -> void;
+// point the attributes at the vertices starting at offset in the bound array buffer
+auto set_attribute_pointers(std::span<const AttributeDesc> descs, std::span<const GLint> locations, GLsizei stride, size_t offset) -> void;
+
+// packed component types
+template <class T>
+struct ComponentFormat;
+
+template <>
+struct ComponentFormat<GLfloat> {
+    static constexpr auto type       = GLenum(GL_FLOAT);
+    static constexpr auto normalized = GLboolean(GL_FALSE);
+};
+
+// colors, 0-255 to 0.0-1.0
+template <>
+struct ComponentFormat<GLubyte> {
+    static constexpr auto type       = GLenum(GL_UNSIGNED_BYTE);
+    static constexpr auto normalized = GLboolean(GL_TRUE);
+};
+
+// texture coordinates, 0-65535 to 0.0-1.0
+template <>
+struct ComponentFormat<GLushort> {
+    static constexpr auto type       = GLenum(GL_UNSIGNED_SHORT);
+    static constexpr auto normalized = GLboolean(GL_TRUE);
+};
+
+template <class T>
+struct FieldFormat {
+    using Component                  = T;
+    static constexpr auto components = 1;
+};
+
+template <class T, size_t N>
+struct FieldFormat<T[N]> {
+    using Component                  = T;
+    static constexpr auto components = int(N);
+};
+
+template <class T, size_t N>
+struct FieldFormat<std::array<T, N>> {
+    using Component                  = T;
+    static constexpr auto components = int(N);
+};
+
+template <class M>
+struct MemberTraits;
+
+template <class V, class F>
+struct MemberTraits<F V::*> {
+    using Vertex = V;
+    using Field  = F;
+};
+
+template <size_t N>
+struct AttributeName {
+    char str[N];
+
+    constexpr AttributeName(const char (&name)[N]) {
+        std::copy_n(name, N, str);
+    }
+};
+
+// one shader input sourced from a field of the vertex struct
+// scalar fields can be grouped by listing the following ones, like &V::x, &V::y
+template <AttributeName name, auto member, auto... rest>
+struct Attribute {
+    using Vertex = MemberTraits<decltype(member)>::Vertex;
+    using Field  = MemberTraits<decltype(member)>::Field;
+    using Format = ComponentFormat<typename FieldFormat<Field>::Component>;
+
+    static constexpr auto components = FieldFormat<Field>::components + int(sizeof...(rest));
+
+    static_assert(sizeof...(rest) == 0 || FieldFormat<Field>::components == 1, "only scalar fields can be grouped");
+    static_assert((std::same_as<decltype(rest), decltype(member)> && ...), "grouped fields must be of the same type and vertex");
+    static_assert(components <= 4 && sizeof(Field) * (1 + sizeof...(rest)) <= sizeof(Vertex));
+
+    static auto desc() -> AttributeDesc {
+        static const auto vertex    = Vertex();
+        const auto        offset_of = [](const auto m) {
+            return size_t(reinterpret_cast<const std::byte*>(&(vertex.*m)) - reinterpret_cast<const std::byte*>(&vertex));
+        };
+        const auto offset = offset_of(member);
+        // each grouped field must directly follow the previous one
+        [[maybe_unused]] auto next        = offset;
+        const auto            consecutive = ((offset_of(rest) == (next += sizeof(Field))) && ...);
+        return {name.str, components, Format::type, Format::normalized, offset, consecutive};
+    }
+};
+
+// interleaved vertex format, generates the vertex array setup
+template <class First, class... Rest>
+class VertexLayout {
+  public:
+    using Vertex = First::Vertex;
+
+    static_assert((std::same_as<Vertex, typename Rest::Vertex> && ...), "attributes of different vertex types");
+
+  private:
+    std::array<GLint, 1 + sizeof...(Rest)> locations;
+
+    static auto descs() -> const std::array<AttributeDesc, 1 + sizeof...(Rest)>& {
+        static const auto descs = std::array{First::desc(), Rest::desc()...};
+        return descs;
+    }
+
+  public:
+    auto init(const GLuint program) -> bool {
+        return resolve_attributes(program, descs(), locations);
+    }
+
+    // per vertex array, divisor 1 for per-instance attributes
+    auto enable(const GLuint divisor = 0) const -> void {
+        enable_attributes(locations, divisor);
+    }
+
+    // per vertex array, or per draw when sourcing from the ring
+    auto set_pointers(const size_t offset = 0) const -> void {
+        set_attribute_pointers(descs(), locations, sizeof(Vertex), offset);
+    }
+};
+
+// {float(x), float(y)} for each point, written every stride bytes from dst
+// dst is the first vertex, positions are expected at the head of the vertex
+// plain scalar loop, an sse2 kernel was slower at the 12 and 16 byte strides of the vertex types
+auto pack_points(std::span<const Point> points, void* dst, size_t stride) -> void;
+} // namespace gawl::impl
@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include "vertex-ring.hpp"
+
+namespace gawl::impl {
+auto VertexRing::get_buffer() const -> GLuint {
+    return buffer;
+}
+
+auto VertexRing::bind() const -> VertexBufferBinder {
+    return buffer;
+}
+
+auto VertexRing::write(const void* const data, const size_t size, const size_t align) -> size_t {
+    const auto vbbinder = bind();
+
+    auto offset = (cursor + align - 1) / align * align;
+    if(offset + size > capacity) {
+        capacity = std::max(capacity, std::bit_ceil(size));
+        offset   = 0;
+        glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+    }
+    const auto ptr = glMapBufferRange(GL_ARRAY_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    std::memcpy(ptr, data, size);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    cursor = offset + size;
+    return offset;
+}
+
+auto VertexRing::init(const size_t capacity) -> void {
+    this->capacity = capacity;
+    glGenBuffers(1, &buffer);
+    const auto vbbinder = bind();
+    glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+}
+
+VertexRing::~VertexRing() {
+    if(buffer != 0) {
+        glDeleteBuffers(1, &buffer);
+        bind_cache.forget(BindCache::ArrayBuffer, buffer);
+    }
+}
+} // namespace gawl::impl
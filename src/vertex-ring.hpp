@@ -0,0 +1,23 @@
+#pragma once
+#include "binder.hpp"
+
+namespace gawl::impl {
+// streaming vertex buffer shared by the batched primitives
+// writes go to the unused tail without synchronization, and the buffer is orphaned when it wraps around
+class VertexRing {
+  private:
+    GLuint buffer   = 0;
+    size_t capacity = 0;
+    size_t cursor   = 0;
+
+  public:
+    auto get_buffer() const -> GLuint;
+    auto bind() const -> VertexBufferBinder;
+    // returns the byte offset of the copied data, aligned to align
+    // so that offset / stride can be used as the first vertex
+    auto write(const void* data, size_t size, size_t align) -> size_t;
+    auto init(size_t capacity) -> void;
+
+    ~VertexRing();
+};
+} // namespace gawl::impl
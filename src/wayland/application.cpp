@@ -68,6 +68,7 @@ WaylandApplication::WaylandApplication(std::vector<towl::impl::InterfaceBinder*>
 
     // initialize egl
     ASSERT(eglMakeCurrent(egl.display, EGL_NO_SURFACE, EGL_NO_SURFACE, egl.context) != EGL_FALSE);
+    impl::invalidate_bind_cache();
     impl::global = new impl::Shaders();
     ASSERT(impl::global->init());
 }
@@ -1,4 +1,5 @@
 #include "eglobject.hpp"
+#include "../binder.hpp"
 #include "../macros/assert.hpp"
 
 namespace gawl {
@@ -10,9 +11,28 @@ auto EGLSubObject::wait() -> void {
     glFinish();
 }
 
+auto EGLSubObject::fence() -> std::optional<Fence> {
+    return Fence::create(display);
+}
+
+auto EGLSubObject::make_current() -> void {
+    ASSERT(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context) != EGL_FALSE);
+    impl::invalidate_bind_cache();
+}
+
+auto EGLSubObject::release() -> void {
+    ASSERT(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) != EGL_FALSE);
+    impl::invalidate_bind_cache();
+    ASSERT(eglReleaseThread() != EGL_FALSE);
+}
+
 auto EGLSubObject::destroy() -> void {
     if(context != nullptr) {
-        ASSERT(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) != EGL_FALSE);
+        // may be destroyed from other thread than the owner, do not release the caller's context
+        if(eglGetCurrentContext() == context) {
+            ASSERT(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) != EGL_FALSE);
+            impl::invalidate_bind_cache();
+        }
         ASSERT(eglDestroyContext(display, context) != EGL_FALSE);
         context = nullptr;
     }
@@ -33,6 +53,7 @@ EGLSubObject::EGLSubObject(const EGLDisplay display, const EGLContext context)
     : display(display),
       context(context) {
     ASSERT(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context) != EGL_FALSE);
+    impl::invalidate_bind_cache();
 }
 
 EGLSubObject::~EGLSubObject() {
@@ -54,23 +75,36 @@ EGLObject::EGLObject(towl::Display& wl_display) {
     ASSERT((major == 1 && minor >= 4) || major >= 2);
     ASSERT(eglBindAPI(EGL_OPENGL_API) != EGL_FALSE);
 
-    constexpr auto config_attribs = std::array<EGLint, 15>{EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
+    constexpr auto config_attribs = std::array<EGLint, 17>{EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
                                                            EGL_RED_SIZE, 8,
                                                            EGL_GREEN_SIZE, 8,
                                                            EGL_BLUE_SIZE, 8,
                                                            EGL_ALPHA_SIZE, 8,
+                                                           EGL_STENCIL_SIZE, 8,
                                                            EGL_SAMPLES, 4,
                                                            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
                                                            EGL_NONE};
 
     auto num = EGLint(0);
     ASSERT(eglChooseConfig(display, config_attribs.data(), &config, 1, &num) != EGL_FALSE && num != 0);
+    auto stencil_size = EGLint(0);
+    ASSERT(eglGetConfigAttrib(display, config, EGL_STENCIL_SIZE, &stencil_size) != EGL_FALSE);
+    stencil_buffer = stencil_size > 0;
     context = eglCreateContext(display, config, EGL_NO_CONTEXT, context_attribs.data());
     ASSERT(context != EGL_NO_CONTEXT);
+
+    const auto extensions = std::string_view(eglQueryString(display, EGL_EXTENSIONS));
+    buffer_age            = extensions.contains("EGL_EXT_buffer_age");
+    if(extensions.contains("EGL_KHR_swap_buffers_with_damage")) {
+        swap_buffers_with_damage = std::bit_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+    } else if(extensions.contains("EGL_EXT_swap_buffers_with_damage")) {
+        swap_buffers_with_damage = std::bit_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+    }
 }
 
 EGLObject::~EGLObject() {
     ASSERT(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) != EGL_FALSE);
+    impl::invalidate_bind_cache();
     ASSERT(eglDestroyContext(display, context) != EGL_FALSE);
     ASSERT(eglTerminate(display) != EGL_FALSE);
     ASSERT(eglReleaseThread() != EGL_FALSE);
@@ -6,7 +6,9 @@
 #include <GL/glext.h>
 
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
+#include "fence.hpp"
 #include "towl/display.hpp"
 
 namespace gawl {
@@ -16,6 +18,12 @@ struct EGLSubObject {
 
     auto flush() -> void;
     auto wait() -> void;
+    auto fence() -> std::optional<Fence>;
+    // binds the context to the calling thread
+    auto make_current() -> void;
+    // unbinds the context and frees egl state of the calling thread
+    // must be called before the thread exits if the context was current on it
+    auto release() -> void;
     auto destroy() -> void;
 
     auto operator=(EGLSubObject&& o) -> EGLSubObject&;
@@ -34,6 +42,11 @@ struct EGLObject {
     EGLDisplay display = nullptr;
     EGLConfig  config  = nullptr;
     EGLContext context = nullptr;
+    bool       stencil_buffer; // of the chosen config
+
+    // optional extensions
+    PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC swap_buffers_with_damage = nullptr;
+    bool                               buffer_age               = false;
 
     auto fork() const -> EGLSubObject;
 
@@ -0,0 +1,130 @@
+#include <string_view>
+
+#include <coop/io.hpp>
+#include <coop/promise.hpp>
+#include <coop/timer.hpp>
+#include <unistd.h>
+
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+
+#include "../macros/assert.hpp"
+#include "fence.hpp"
+
+namespace gawl {
+namespace {
+struct Procs {
+    PFNEGLCREATESYNCKHRPROC           create_sync;
+    PFNEGLDESTROYSYNCKHRPROC          destroy_sync;
+    PFNEGLCLIENTWAITSYNCKHRPROC       client_wait_sync;
+    PFNEGLDUPNATIVEFENCEFDANDROIDPROC dup_native_fence_fd;
+};
+
+auto get_procs() -> const Procs& {
+    static const auto procs = Procs{
+        .create_sync         = (PFNEGLCREATESYNCKHRPROC)(eglGetProcAddress("eglCreateSyncKHR")),
+        .destroy_sync        = (PFNEGLDESTROYSYNCKHRPROC)(eglGetProcAddress("eglDestroySyncKHR")),
+        .client_wait_sync    = (PFNEGLCLIENTWAITSYNCKHRPROC)(eglGetProcAddress("eglClientWaitSyncKHR")),
+        .dup_native_fence_fd = (PFNEGLDUPNATIVEFENCEFDANDROIDPROC)(eglGetProcAddress("eglDupNativeFenceFDANDROID")),
+    };
+    return procs;
+}
+
+// eglGetProcAddress may return non-null for unsupported functions
+auto has_fence_sync(const EGLDisplay display) -> bool {
+    // applications have only one display
+    static const auto result = [display]() {
+        const auto  extensions = eglQueryString(display, EGL_EXTENSIONS);
+        const auto& procs      = get_procs();
+        return extensions != nullptr && std::string_view(extensions).contains("EGL_KHR_fence_sync") &&
+               procs.create_sync != nullptr && procs.destroy_sync != nullptr && procs.client_wait_sync != nullptr;
+    }();
+    return result;
+}
+
+auto has_native_fence(const EGLDisplay display) -> bool {
+    // applications have only one display
+    static const auto result = [display]() {
+        const auto extensions = eglQueryString(display, EGL_EXTENSIONS);
+        return extensions != nullptr && std::string_view(extensions).contains("EGL_ANDROID_native_fence_sync") && get_procs().dup_native_fence_fd != nullptr;
+    }();
+    return result;
+}
+} // namespace
+
+auto Fence::destroy() -> void {
+    if(fd != -1) {
+        close(fd);
+        fd = -1;
+    }
+    if(sync != EGL_NO_SYNC_KHR) {
+        get_procs().destroy_sync(display, sync);
+        sync = EGL_NO_SYNC_KHR;
+    }
+}
+
+auto Fence::create(const EGLDisplay display) -> std::optional<Fence> {
+    const auto& procs = get_procs();
+    if(!has_fence_sync(display)) {
+        // expected on some drivers, callers fall back to glFinish()
+        return std::nullopt;
+    }
+
+    auto fence    = Fence();
+    fence.display = display;
+    if(has_native_fence(display)) {
+        fence.sync = procs.create_sync(display, EGL_SYNC_NATIVE_FENCE_ANDROID, nullptr);
+        if(fence.sync != EGL_NO_SYNC_KHR) {
+            // the fd is available after flush
+            glFlush();
+            if(const auto fd = procs.dup_native_fence_fd(display, fence.sync); fd != EGL_NO_NATIVE_FENCE_FD_ANDROID) {
+                fence.fd = fd;
+            }
+            return fence;
+        }
+    }
+    fence.sync = procs.create_sync(display, EGL_SYNC_FENCE_KHR, nullptr);
+    ensure(fence.sync != EGL_NO_SYNC_KHR);
+    // other contexts never see it unless flushed
+    glFlush();
+    return fence;
+}
+
+auto Fence::is_signaled() const -> bool {
+    return get_procs().client_wait_sync(display, sync, 0, 0) == EGL_CONDITION_SATISFIED_KHR;
+}
+
+auto Fence::wait() const -> coop::Async<bool> {
+    constexpr auto error_value = false;
+
+    if(fd != -1) {
+        const auto result = co_await coop::wait_for_file(fd, true, false);
+        co_ensure_v(!result.error);
+        co_return true;
+    }
+    while(true) {
+        const auto result = get_procs().client_wait_sync(display, sync, 0, 0);
+        co_ensure_v(result != EGL_FALSE);
+        if(result == EGL_CONDITION_SATISFIED_KHR) {
+            co_return true;
+        }
+        co_await coop::sleep(std::chrono::milliseconds(1));
+    }
+}
+
+auto Fence::operator=(Fence&& o) -> Fence& {
+    destroy();
+    display = o.display;
+    sync    = std::exchange(o.sync, EGL_NO_SYNC_KHR);
+    fd      = std::exchange(o.fd, -1);
+    return *this;
+}
+
+Fence::Fence(Fence&& o) {
+    *this = std::move(o);
+}
+
+Fence::~Fence() {
+    destroy();
+}
+} // namespace gawl
@@ -0,0 +1,33 @@
+#pragma once
+#include <optional>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <coop/generator.hpp>
+
+namespace gawl {
+// signaled when the gpu finished the commands issued before its creation
+// can be awaited from any thread sharing the display
+class Fence {
+  private:
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLSyncKHR sync    = EGL_NO_SYNC_KHR;
+    int        fd      = -1; // native fence, pollable
+
+    auto destroy() -> void;
+
+  public:
+    // inserts a fence into the command stream of the current context
+    // nullopt without EGL_KHR_fence_sync
+    static auto create(EGLDisplay display = eglGetCurrentDisplay()) -> std::optional<Fence>;
+
+    auto is_signaled() const -> bool;
+    auto wait() const -> coop::Async<bool>;
+
+    auto operator=(Fence&& o) -> Fence&;
+
+    Fence() = default;
+    Fence(Fence&& o);
+    ~Fence();
+};
+} // namespace gawl
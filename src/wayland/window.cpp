@@ -1,6 +1,8 @@
 #include <coop/single-event.hpp>
 #include <coop/task-handle.hpp>
 
+#include "../batch.hpp"
+#include "../global.hpp"
 #include "../macros/assert.hpp"
 #include "eglobject.hpp"
 #include "window.hpp"
@@ -45,6 +47,7 @@ auto choose_surface(const EGLSurface eglsurface, const impl::EGLObject& egl) ->
     if(current_surface == eglsurface) {
         return;
     }
+    impl::flush_pending_batch();
     ASSERT(eglMakeCurrent(egl.display, eglsurface, eglsurface, egl.context) != EGL_FALSE);
     current_surface = eglsurface;
 }
@@ -63,8 +66,15 @@ auto WaylandWindow::init_egl() -> bool {
     return true;
 }
 
-auto WaylandWindow::swap_buffer() -> bool {
-    ensure(eglSwapBuffers(egl->display, egl_surface) == EGL_TRUE);
+auto WaylandWindow::swap_buffer(const Rectangle& damage) -> bool {
+    impl::flush_pending_batch();
+    if(egl->swap_buffers_with_damage != nullptr) {
+        // lower left origin, the compositor is told to update only this region
+        auto rect = std::array{EGLint(damage.a.x), EGLint(buffer_size.size[1] - damage.b.y), EGLint(damage.width()), EGLint(damage.height())};
+        ensure(egl->swap_buffers_with_damage(egl->display, egl_surface, rect.data(), 1) == EGL_TRUE);
+    } else {
+        ensure(eglSwapBuffers(egl->display, egl_surface) == EGL_TRUE);
+    }
     return true;
 }
 
@@ -115,13 +125,33 @@ auto WaylandWindow::refresh() -> bool {
         obsolete_egl_window_size = false;
         egl_window.resize(buffer_size.size[0], buffer_size.size[1], 0, 0);
         wayland_surface.set_buffer_scale(buffer_size.scale);
+        damage_history.clear();
+        damage.reset();
+    }
+
+    // repaint the damage of this frame and what the back buffer missed
+    const auto full  = get_buffer_rect();
+    const auto frame = std::exchange(damage, std::nullopt).value_or(full);
+    auto       age   = EGLint(0);
+    if(egl->buffer_age) {
+        eglQuerySurface(egl->display, egl_surface, EGL_BUFFER_AGE_EXT, &age);
     }
+    const auto region = damage_history.get_repaint(frame, age);
+    damage_history.push(frame);
+
+    begin_repaint(region);
     callbacks->refresh();
+    end_repaint();
+    impl::frame_count += 1;
     wayland_surface.set_frame();
-    ensure(swap_buffer());
+    ensure(swap_buffer(frame));
     return true;
 }
 
+auto WaylandWindow::has_stencil_buffer() const -> bool {
+    return egl->stencil_buffer;
+}
+
 auto WaylandWindow::fork_context() -> EGLSubObject {
     return egl->fork();
 }
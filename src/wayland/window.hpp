@@ -2,6 +2,7 @@
 #include <EGL/egl.h>
 
 #include "../window-creat-hint.hpp"
+#include "../damage.hpp"
 #include "../window.hpp"
 #include "eglobject.hpp"
 #include "wl-object.hpp"
@@ -48,15 +49,20 @@ class WaylandWindow : public Window {
     coop::Runner*    runner;
     coop::TaskHandle key_repeater;
 
+    impl::DamageHistory damage_history;
+
     bool obsolete_egl_window_size = true;
     bool frame_done               = true;
     bool latest_frame             = true;
 
     auto init_egl() -> bool;
-    auto swap_buffer() -> bool;
+    auto swap_buffer(const Rectangle& damage) -> bool;
     auto resize_buffer(const int width, const int height, const int scale) -> bool;
     auto dispatch_pending_callbacks() -> coop::Async<bool>;
 
+    // Screen
+    auto has_stencil_buffer() const -> bool override;
+
     // for users
     auto refresh() -> bool override;
     auto fork_context() -> EGLSubObject;
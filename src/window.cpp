@@ -1,8 +1,12 @@
+#include <cmath>
+
+#include "batch.hpp"
 #include "window.hpp"
 
 namespace gawl {
 auto Window::on_buffer_resize(const std::optional<std::array<size_t, 2>> size, const std::optional<size_t> scale) -> void {
     constexpr auto MIN_SCALE = 0.01;
+    impl::flush_pending_batch();
     if(size) {
         buffer_size.size = *size;
     }
@@ -21,6 +25,27 @@ auto Window::on_buffer_resize(const std::optional<std::array<size_t, 2>> size, c
     window_size[1] = viewport.size[1] / draw_scale;
 }
 
+auto Window::get_buffer_rect() const -> Rectangle {
+    return {{0, 0}, {double(buffer_size.size[0]), double(buffer_size.size[1])}};
+}
+
+auto Window::apply_scissor() const -> void {
+    apply_clip(repaint, buffer_size.size[1]);
+}
+
+auto Window::begin_repaint(const std::optional<Rectangle> region) -> void {
+    impl::flush_pending_batch();
+    repaint = region;
+    apply_scissor();
+}
+
+auto Window::end_repaint() -> void {
+    // pending draws belong to the region
+    impl::flush_pending_batch();
+    repaint.reset();
+    apply_scissor();
+}
+
 auto Window::set_callbacks(std::shared_ptr<WindowCallbacks> callbacks) -> void {
     this->callbacks         = std::move(callbacks);
     this->callbacks->window = this;
@@ -36,8 +61,10 @@ auto Window::set_scale(const double scale) -> void {
 }
 
 auto Window::prepare() -> impl::FramebufferBinder {
+    impl::flush_pending_batch();
     auto binder = impl::FramebufferBinder(0);
     glViewport(viewport.base[0], viewport.gl_y, viewport.size[0], viewport.size[1]);
+    apply_scissor();
     return binder;
 }
 
@@ -46,13 +73,34 @@ auto Window::get_viewport() const -> const Viewport& {
 }
 
 auto Window::set_viewport(const gawl::Rectangle& region) -> void {
+    impl::flush_pending_batch();
     viewport.set(region * draw_scale, buffer_size.size);
 }
 
 auto Window::unset_viewport() -> void {
+    impl::flush_pending_batch();
     viewport.unset(buffer_size.size);
 }
 
+auto Window::add_damage(const Rectangle& rect) -> void {
+    // whole pixels, with the antialiased edges around the rect
+    auto r = rect * draw_scale;
+    r      = {{std::floor(r.a.x) - 1, std::floor(r.a.y) - 1}, {std::ceil(r.b.x) + 1, std::ceil(r.b.y) + 1}};
+    r &= get_buffer_rect();
+    if(r.width() <= 0 || r.height() <= 0) {
+        return;
+    }
+    if(damage) {
+        *damage |= r;
+    } else {
+        damage = r;
+    }
+}
+
+auto Window::get_repaint_region() const -> Rectangle {
+    return repaint.value_or(get_buffer_rect()) * (1 / draw_scale);
+}
+
 auto Window::set_follow_buffer_scale(const bool flag) -> void {
     if(flag == follow_buffer_scale) {
         return;
@@ -1,6 +1,7 @@
 #pragma once
 #include <array>
 #include <memory>
+#include <optional>
 
 #include "binder.hpp"
 #include "screen.hpp"
@@ -25,9 +26,18 @@ class Window : public Screen {
     std::array<int, 2> window_size;                     // read-only
     Viewport           viewport = {{0, 0}, {800, 600}}; // read-only
 
+    std::optional<Rectangle> damage;  // in buffer pixels, reported for the next refresh
+    std::optional<Rectangle> repaint; // in buffer pixels, region of the running refresh if partial
+
     std::shared_ptr<WindowCallbacks> callbacks; // use set_callbacks to set
 
     auto on_buffer_resize(std::optional<std::array<size_t, 2>> size, std::optional<size_t> scale) -> void;
+    auto get_buffer_rect() const -> Rectangle;
+    // scissor to the repaint region and the clip, the window framebuffer must be bound
+    auto apply_scissor() const -> void;
+    // limit the following draws to the region until end_repaint()
+    auto begin_repaint(std::optional<Rectangle> region) -> void;
+    auto end_repaint() -> void;
     auto set_callbacks(std::shared_ptr<WindowCallbacks> callbacks) -> void;
 
     // MetaScreen
@@ -43,6 +53,12 @@ class Window : public Screen {
     // user apis
     virtual auto refresh() -> bool = 0; // trigger screen refresh
     auto         set_follow_buffer_scale(bool flag) -> void;
+    // report a changed area in screen coordinates for the next refresh
+    // only the damaged area is repainted and presented, refreshes without damage repaint the whole window
+    auto add_damage(const Rectangle& rect) -> void;
+    // region being repainted, in screen coordinates, draws outside of it have no effect
+    // callbacks can skip everything else during refresh()
+    auto get_repaint_region() const -> Rectangle;
 
     virtual ~Window() {}
 };